@@ -59,6 +59,16 @@ if(NOT TARGET HighFiveMdspanDependency)
   endif()
 endif()
 
+if(NOT TARGET HighFiveZlibDependency)
+  add_library(HighFiveZlibDependency INTERFACE)
+  if(HIGHFIVE_TEST_ZLIB)
+    find_package(ZLIB REQUIRED)
+    find_package(Threads REQUIRED)
+    target_link_libraries(HighFiveZlibDependency INTERFACE ZLIB::ZLIB Threads::Threads)
+    target_compile_definitions(HighFiveZlibDependency INTERFACE HIGHFIVE_TEST_ZLIB=1)
+  endif()
+endif()
+
 if(NOT TARGET HighFiveOptionalDependencies)
   add_library(HighFiveOptionalDependencies INTERFACE)
   target_link_libraries(HighFiveOptionalDependencies INTERFACE
@@ -68,5 +78,6 @@ if(NOT TARGET HighFiveOptionalDependencies)
     HighFiveOpenCVDependency
     HighFiveSpanDependency
     HighFiveMdspanDependency
+    HighFiveZlibDependency
   )
 endif()
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace HighFive {
+
+///
+/// \brief An allocator that default-initializes instead of value-initializing.
+///
+/// `std::vector<T>::resize` value-initializes the new elements, i.e. fills
+/// them with zeros for arithmetic types. When reading, every element is
+/// overwritten immediately afterwards, hence this is a wasted pass over the
+/// memory. With a `default_init_allocator`, `resize` leaves elements of
+/// trivial types uninitialized. All other uses of the allocator, e.g.
+/// `resize(n, value)` or `push_back`, behave as with `A`.
+///
+/// \code{.cpp}
+/// auto values = dset.read<uninitialized_vector<float>>();
+/// \endcode
+///
+/// \since 3.4
+template <class T, class A = std::allocator<T>>
+class default_init_allocator: public A {
+    using traits = std::allocator_traits<A>;
+
+  public:
+    template <class U>
+    struct rebind {
+        using other = default_init_allocator<U, typename traits::template rebind_alloc<U>>;
+    };
+
+    using A::A;
+
+    default_init_allocator() = default;
+
+    template <class U, class B>
+    default_init_allocator(const default_init_allocator<U, B>& other) noexcept
+        : A(static_cast<const B&>(other)) {}
+
+    template <class U>
+    void construct(U* ptr) noexcept(std::is_nothrow_default_constructible<U>::value) {
+        ::new (static_cast<void*>(ptr)) U;
+    }
+
+    template <class U, class... Args>
+    void construct(U* ptr, Args&&... args) {
+        traits::construct(static_cast<A&>(*this), ptr, std::forward<Args>(args)...);
+    }
+};
+
+///
+/// \brief A `std::vector` whose `resize` doesn't zero trivial elements.
+///
+/// \since 3.4
+template <class T>
+using uninitialized_vector = std::vector<T, default_init_allocator<T>>;
+
+}  // namespace HighFive
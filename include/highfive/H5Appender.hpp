@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5Selection.hpp"
+
+namespace HighFive {
+
+///
+/// \brief Append rows to an extensible dataset in chunk-sized batches.
+///
+/// Calling `DataSet::resize` followed by a tiny `write` for every record costs
+/// one `H5Dset_extent` and one `H5Dwrite` per record. An `Appender` instead
+/// buffers the rows in memory and writes them once the buffer reaches the end
+/// of a batch. Batches consist of whole chunks and are aligned with the chunks
+/// of the dataset, hence every chunk is written only once. The extent of the
+/// dataset is grown geometrically, in multiples of the batch size, and trimmed
+/// to the number of rows appended by `flush` or the destructor.
+///
+/// A row is an element of the dataset along the first axis, i.e. `T` is `double`
+/// for a one-dimensional dataset and, e.g., `std::vector<double>` or
+/// `std::array<double, 3>` for a two-dimensional dataset.
+///
+/// \code{.cpp}
+/// auto dset = file.createDataSet<double>("x",
+///                                        DataSpace({0, 3}, {DataSpace::UNLIMITED, 3}),
+///                                        props);  // chunked, e.g. {1024, 3}.
+///
+/// auto appender = dset.appender<std::array<double, 3>>();
+/// for (const auto& record: records) {
+///     appender.append({record.x, record.y, record.z});
+/// }
+/// appender.flush();
+/// \endcode
+///
+/// Rows are appended after the existing rows of the dataset. Until `flush` is
+/// called, the dataset may contain up to one batch of unwritten rows, which
+/// read as the fill value, and its extent may be larger than the number of
+/// rows appended.
+///
+/// \since 3.4
+template <class T>
+class Appender {
+  public:
+    ///
+    /// \brief Prepare to append rows of type `T` to `dataset`.
+    ///
+    /// The rows are written in batches of `rows_per_batch` rows, rounded up to
+    /// a multiple of the number of rows per chunk. If `rows_per_batch` is `0`,
+    /// a batch is a single chunk. Throws a `DataSetException` if the dataset
+    /// isn't chunked; and a `DataSpaceException` if `T` can't be a row of
+    /// the dataset, e.g. `double` for a two-dimensional dataset.
+    explicit Appender(const DataSet& dataset, size_t rows_per_batch = 0);
+
+    Appender(const Appender&) = delete;
+    Appender& operator=(const Appender&) = delete;
+
+    Appender(Appender&& other) noexcept;
+    Appender& operator=(Appender&& other);
+
+    ///
+    /// \brief Calls `flush`; errors are logged, not thrown.
+    ~Appender();
+
+    ///
+    /// \brief Append a single row.
+    ///
+    /// Throws a `DataSpaceException` if the number of elements of `row`
+    /// doesn't match the dimensions of the dataset.
+    void append(const T& row);
+
+    ///
+    /// \brief Append the rows `[first, last)`.
+    template <class Iterator>
+    void append(Iterator first, Iterator last);
+
+    ///
+    /// \brief Write all buffered rows and trim the dataset to `size()` rows.
+    void flush();
+
+    ///
+    /// \brief Number of rows of the dataset, including the buffered rows.
+    size_t size() const noexcept;
+
+    ///
+    /// \brief Number of rows that haven't been written yet.
+    size_t getBufferedRows() const noexcept;
+
+    ///
+    /// \brief Number of rows per batch.
+    size_t getBatchRows() const noexcept;
+
+    ///
+    /// \brief Number of rows the dataset has been extended to.
+    size_t capacity() const noexcept;
+
+  private:
+    // Flushes, unless moved from; errors are logged.
+    void release() noexcept;
+
+    // Writes the buffer, extending the dataset if needed.
+    void writeBuffer();
+
+    DataSet _dataset;
+    std::vector<size_t> _dims;
+    std::vector<size_t> _max_dims;
+    size_t _row_size;
+    size_t _batch_rows;
+    size_t _n_written;
+    std::vector<T> _buffer;
+    bool _is_owner = true;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5Appender_misc.hpp"
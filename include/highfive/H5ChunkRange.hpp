@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5Selection.hpp"
+
+namespace HighFive {
+
+///
+/// \brief A range of chunk-aligned blocks covering a chunked dataset.
+///
+/// The blocks are aligned with the chunks of the dataset and enumerated in
+/// the order of the chunk coordinates, i.e. in row-major order of the grid of
+/// chunks. Each block consists of one or more whole chunks; blocks at the end
+/// of an axis are clipped to the extent of the dataset. Reading the blocks
+/// one after the other therefore never decompresses a chunk more than once
+/// and needs memory for only one block at a time.
+///
+/// If more than one chunk is requested per step, neighbouring chunks along
+/// the last axis are grouped first; once a block spans the entire last axis,
+/// chunks along the previous axis are grouped, and so on.
+///
+/// \code{.cpp}
+/// auto transfer_buffer = TransferBuffer();
+/// auto values = std::vector<std::vector<double>>{};
+/// for (const auto& block: dset.chunks(/* chunks_per_step = */ 4)) {
+///     block.read(values, transfer_buffer);
+///     // process `values`.
+/// }
+/// \endcode
+///
+/// The `ChunkRange` must outlive its iterators.
+///
+/// \since 3.4
+class ChunkRange {
+  public:
+    class iterator {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Selection;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Selection;
+
+        iterator() = default;
+
+        /// \brief Selection of the current block.
+        Selection operator*() const;
+
+        iterator& operator++();
+        iterator operator++(int);
+
+        bool operator==(const iterator& other) const;
+        bool operator!=(const iterator& other) const;
+
+        /// \brief Offset of the current block in the dataset.
+        std::vector<size_t> getOffset() const;
+
+        /// \brief Number of elements of the current block along each axis.
+        std::vector<size_t> getCount() const;
+
+      private:
+        iterator(const ChunkRange* range, size_t index);
+
+        const ChunkRange* _range = nullptr;
+        size_t _index = 0;
+
+        friend class ChunkRange;
+    };
+
+    using const_iterator = iterator;
+
+    ///
+    /// \brief Enumerate the chunks of `dataset`, `chunks_per_step` at a time.
+    ///
+    /// Throws a `DataSetException` if the dataset isn't chunked.
+    explicit ChunkRange(const DataSet& dataset, size_t chunks_per_step = 1);
+
+    iterator begin() const;
+    iterator end() const;
+
+    /// \brief Number of blocks.
+    size_t size() const;
+
+    /// \brief Selection of the `i`-th block.
+    Selection operator[](size_t i) const;
+
+    /// \brief Offset of the `i`-th block in the dataset.
+    std::vector<size_t> getOffset(size_t i) const;
+
+    /// \brief Number of elements of the `i`-th block along each axis.
+    std::vector<size_t> getCount(size_t i) const;
+
+    /// \brief Dimensions of a single chunk.
+    const std::vector<size_t>& getChunkDimensions() const;
+
+    /// \brief Dimensions of a block, before clipping at the dataset's extent.
+    const std::vector<size_t>& getBlockDimensions() const;
+
+    ///
+    /// \brief Number of elements in the largest block.
+    ///
+    /// Useful for preallocating a buffer that is reused for every block.
+    size_t getMaxElementCount() const;
+
+  private:
+    DataSet _dataset;
+    std::vector<size_t> _dims;
+    std::vector<size_t> _chunk_dims;
+    std::vector<size_t> _block_dims;
+    std::vector<size_t> _n_blocks;
+    size_t _size = 0;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5ChunkRange_misc.hpp"
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5DataSpace.hpp"
+#include "H5Selection.hpp"
+
+namespace HighFive {
+
+///
+/// \brief A selection that can be applied to many datasets of the same shape.
+///
+/// Creating a complicated selection, e.g. a `ProductSet` of many indices or
+/// a `HyperSlab` of many blocks, can cost more than reading the selected
+/// elements. A `CompiledSelection` keeps the file and memory dataspaces of a
+/// `Selection`; binding it to another dataset doesn't select anything again:
+///
+/// \code{.cpp}
+/// auto compiled = CompiledSelection(datasets[0].select(ProductSet(rows, cols)));
+/// for (const auto& dset: datasets) {
+///     compiled.bind(dset).read(values);
+/// }
+/// \endcode
+///
+/// The dataspaces are shared, not copied, by all bound selections.
+///
+/// \since 3.4
+class CompiledSelection {
+  public:
+    ///
+    /// \brief Keep the dataspaces of `selection`.
+    explicit CompiledSelection(const Selection& selection);
+
+    ///
+    /// \brief The same selection, of the elements of `dataset`.
+    ///
+    /// Throws a `DataSpaceException` unless the dimensions of `dataset` are
+    /// those of the dataset the selection was made for.
+    Selection bind(const DataSet& dataset) const;
+
+    ///
+    /// \brief The dimensions of the datasets this selection can be bound to.
+    const std::vector<size_t>& getDimensions() const noexcept {
+        return _dims;
+    }
+
+    ///
+    /// \brief The selected elements of the file dataspace.
+    DataSpace getSpace() const {
+        return _file_space;
+    }
+
+    ///
+    /// \brief The memory dataspace.
+    DataSpace getMemSpace() const {
+        return _mem_space;
+    }
+
+  private:
+    DataSpace _mem_space;
+    DataSpace _file_space;
+    std::vector<size_t> _dims;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5CompiledSelection_misc.hpp"
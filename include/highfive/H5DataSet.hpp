@@ -8,6 +8,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <vector>
 
 #include "H5DataSpace.hpp"
@@ -21,6 +22,29 @@
 
 namespace HighFive {
 
+class ChunkRange;
+
+template <class T>
+class Appender;
+
+template <class T>
+class MappedArray;
+
+///
+/// \brief Location, size and filter mask of a stored chunk.
+///
+/// \since 3.4
+struct ChunkInfo {
+    /// Logical position of the first element of the chunk in the dataset.
+    std::vector<size_t> offset;
+    /// Bit `i` is set if the `i`-th filter was skipped for this chunk.
+    uint32_t filter_mask = 0;
+    /// Address of the chunk in the file.
+    uint64_t address = 0;
+    /// Number of bytes of the chunk, as stored, i.e. after filtering.
+    uint64_t size = 0;
+};
+
 ///
 /// \brief Class representing a dataset.
 ///
@@ -43,6 +67,103 @@ class DataSet: public Object,
     ///
     uint64_t getOffset() const;
 
+#if H5_VERSION_GE(1, 10, 2)
+    ///
+    /// \brief Write the raw bytes of the chunk at `offset`.
+    ///
+    /// The bytes are written as they are, bypassing the filter pipeline. Hence,
+    /// they must already be filtered (e.g. compressed) as specified by the
+    /// dataset creation properties. Bit `i` of `filter_mask` marks the `i`-th
+    /// filter as not applied to this chunk.
+    ///
+    /// \param offset Logical position of the chunk; a multiple of the chunk dimensions.
+    /// \param data The raw bytes of the chunk.
+    /// \param n_bytes Number of bytes of the chunk.
+    /// \param filter_mask Filters skipped for this chunk.
+    /// \param xfer_props Data transfer properties.
+    ///
+    /// \since 3.4
+    void writeChunk(const std::vector<size_t>& offset,
+                    const void* data,
+                    size_t n_bytes,
+                    uint32_t filter_mask = 0,
+                    const DataTransferProps& xfer_props = DataTransferProps());
+
+    ///
+    /// \brief Write the raw bytes of the chunk at `offset`.
+    ///
+    /// Same as `writeChunk(const std::vector<size_t>&, const void*, size_t, ...)`.
+    ///
+    /// \since 3.4
+    void writeChunk(const std::vector<size_t>& offset,
+                    const std::vector<uint8_t>& data,
+                    uint32_t filter_mask = 0,
+                    const DataTransferProps& xfer_props = DataTransferProps());
+
+    ///
+    /// \brief Number of bytes of the chunk at `offset`, as stored in the file.
+    ///
+    /// \since 3.4
+    uint64_t getChunkStorageSize(const std::vector<size_t>& offset) const;
+
+    ///
+    /// \brief Read the raw bytes of the chunk at `offset`.
+    ///
+    /// The bytes are read as they are stored, i.e. without reversing the
+    /// filters. The `buffer` must be at least `getChunkStorageSize(offset)`
+    /// bytes large.
+    ///
+    /// \return The filter mask of the chunk.
+    ///
+    /// \since 3.4
+    uint32_t readChunk(const std::vector<size_t>& offset,
+                       void* buffer,
+                       const DataTransferProps& xfer_props = DataTransferProps()) const;
+
+    ///
+    /// \brief Read the raw bytes of the chunk at `offset` into `buffer`.
+    ///
+    /// The `buffer` is resized to the size of the stored chunk.
+    ///
+    /// \return The filter mask of the chunk.
+    ///
+    /// \since 3.4
+    uint32_t readChunk(const std::vector<size_t>& offset,
+                       std::vector<uint8_t>& buffer,
+                       const DataTransferProps& xfer_props = DataTransferProps()) const;
+#endif
+
+#if H5_VERSION_GE(1, 10, 5)
+    ///
+    /// \brief Number of chunks that have been written to the file.
+    ///
+    /// \since 3.4
+    size_t getNumberChunks() const;
+
+    ///
+    /// \brief Information about the `index`-th stored chunk.
+    ///
+    /// \since 3.4
+    ChunkInfo getChunkInfoByIndex(size_t index) const;
+
+    ///
+    /// \brief Information about the chunk at `offset`.
+    ///
+    /// If the chunk hasn't been written, its `size` is `0`.
+    ///
+    /// \since 3.4
+    ChunkInfo getChunkInfo(const std::vector<size_t>& offset) const;
+
+    ///
+    /// \brief Information about all stored chunks.
+    ///
+    /// Uses `H5Dchunk_iter` if available, otherwise queries the chunks one by
+    /// one.
+    ///
+    /// \since 3.4
+    std::vector<ChunkInfo> listChunks() const;
+#endif
+
     ///
     /// \brief getDataType
     /// \return return the datatype associated with this dataset
@@ -70,6 +191,42 @@ class DataSet: public Object,
     /// \param dims New size of the dataset
     void resize(const std::vector<size_t>& dims);
 
+    ///
+    /// \brief Iterate over the dataset in chunk-aligned blocks.
+    ///
+    /// Each step of the returned range selects `chunks_per_step` whole chunks
+    /// (clipped at the end of the dataset), in the order of the chunk
+    /// coordinates. See `ChunkRange`.
+    ///
+    /// Throws a `DataSetException` if the dataset isn't chunked.
+    ///
+    /// \since 3.4
+    ChunkRange chunks(size_t chunks_per_step = 1) const;
+
+    ///
+    /// \brief Append rows of type `T` in batches of whole chunks.
+    ///
+    /// Grows the dataset along its first axis. See `Appender`.
+    ///
+    /// Throws a `DataSetException` if the dataset isn't chunked.
+    ///
+    /// \since 3.4
+    template <class T>
+    Appender<T> appender(size_t rows_per_batch = 0) const;
+
+    ///
+    /// \brief Map the dataset into memory, read-only, without copying it.
+    ///
+    /// Reads through the page cache instead of `H5Dread`, see `MappedArray`.
+    /// Throws a `DataSetException` unless the dataset is contiguous, not
+    /// filtered, allocated, aligned for `T` and stored with exactly the datatype
+    /// of `T`, including its byte order; and the file uses the default driver.
+    /// Mapping requires a POSIX system.
+    ///
+    /// \since 3.4
+    template <class T>
+    MappedArray<T> map() const;
+
 #if H5_VERSION_GE(1, 10, 0)
     /// \brief flush
     void flush();
@@ -56,6 +56,22 @@ inline DataTypeClass operator&(DataTypeClass lhs, DataTypeClass rhs) {
 class StringType;
 class IntegerType;
 
+namespace detail {
+/// \brief Internal hack to create a `DataType` from an ID.
+///
+/// WARNING: Creating a DataType from an ID has implications w.r.t. the lifetime of the object
+///          that got passed via its ID. Using this method careless opens up the suite of issues
+///          related to C-style resource management, including the analog of double free, dangling
+///          pointers, etc.
+///
+/// NOTE: This is not part of the API and only serves to work around a compiler issue in GCC which
+///       prevents us from using `friend`s instead. This function should only be used for internal
+///       purposes.
+///
+/// \private
+DataType make_data_type(hid_t hid);
+}  // namespace detail
+
 ///
 /// \brief HDF5 Data Type
 ///
@@ -125,6 +141,7 @@ class DataType: public Object {
     friend class CompoundType;
     template <typename Derivate>
     friend class NodeTraits;
+    friend DataType detail::make_data_type(hid_t);
 };
 
 
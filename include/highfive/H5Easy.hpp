@@ -204,6 +204,72 @@ class DumpOptions {
     std::vector<hsize_t> m_chunk_size = {};
 };
 
+///
+/// \brief Append scalars to a one-dimensional, extendible DataSet.
+///
+/// Writing a time series with `dump(file, path, value, {i})` resizes the
+/// DataSet, writes a single element and, by default, flushes the file for
+/// every step. A `Series` keeps the DataSet open and appends the values in
+/// chunk-sized batches, see `HighFive::Appender`: the DataSet grows
+/// geometrically and is trimmed to the number of values appended by `flush`
+/// and the destructor.
+///
+/// \code{.cpp}
+/// H5Easy::Series<double> energy(file, "/energy");
+/// for (size_t i = 0; i < n_steps; ++i) {
+///     energy.push_back(compute_energy(i));
+/// }
+/// \endcode
+///
+/// If the DataSet exists, values are appended after its existing values.
+/// Unless set via `DumpOptions::setChunkSize`, chunks of about 64 KiB are used.
+/// With `Flush::True`, the file is flushed by `flush` and the destructor only,
+/// not after every value. The DumpMode is ignored, like for `dump` with an
+/// index.
+///
+/// \since 3.4
+template <class T>
+class Series {
+  public:
+    ///
+    /// \brief Open, or create, the DataSet at `path`.
+    ///
+    /// \param file opened file (has to be writeable)
+    /// \param path path of the DataSet
+    /// \param options dump options
+    Series(File& file, const std::string& path, const DumpOptions& options = DumpOptions());
+
+    Series(const Series&) = delete;
+    Series& operator=(const Series&) = delete;
+
+    ///
+    /// \brief Calls `flush`; errors are logged, not thrown.
+    ~Series();
+
+    ///
+    /// \brief Append `value` to the DataSet.
+    inline void push_back(const T& value);
+
+    ///
+    /// \brief Write all pending values, trim the DataSet and, with
+    /// `Flush::True`, flush the file.
+    inline void flush();
+
+    ///
+    /// \brief Number of values, including those not yet written.
+    inline size_t size() const;
+
+    ///
+    /// \brief The DataSet values are appended to.
+    inline DataSet getDataSet() const;
+
+  private:
+    File m_file;
+    DataSet m_dataset;
+    HighFive::Appender<T> m_appender;
+    bool m_flush;
+};
+
 ///
 /// \brief Get the size of an existing DataSet in an open HDF5 file.
 ///
@@ -396,3 +462,4 @@ inline T loadAttribute(const File& file, const std::string& path, const std::str
 #include "h5easy_bits/H5Easy_misc.hpp"
 #include "h5easy_bits/H5Easy_public.hpp"
 #include "h5easy_bits/H5Easy_scalar.hpp"
+#include "h5easy_bits/H5Easy_series.hpp"
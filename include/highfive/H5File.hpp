@@ -8,13 +8,17 @@
  */
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <type_traits>
+#include <vector>
 
 #include "H5Object.hpp"
 #include "H5PropertyList.hpp"
 #include "bits/H5Annotate_traits.hpp"
 #include "bits/H5Node_traits.hpp"
+#include "bits/handle_cache.hpp"
 
 namespace HighFive {
 
@@ -154,15 +158,118 @@ class File: public Object, public NodeTraits<File>, public AnnotateTraits<File>
     /// might not track everything or not track across open-close cycles.
     size_t getFreeSpace() const;
 
+    ///
+    /// \brief Open the file image, i.e. the bytes of an HDF5 file, at `data`.
+    ///
+    /// The file is opened with the core driver and never touches the disk.
+    /// With `ReadOnly`, the default, the image isn't copied; the file reads
+    /// directly from `data`, which must remain valid and unmodified until the
+    /// file and all objects opened from it have been closed. With `ReadWrite`,
+    /// HDF5 works on its own copy, which grows as needed; the caller's buffer
+    /// isn't modified.
+    ///
+    /// \code{.cpp}
+    /// auto message = queue.receive();
+    /// auto file = File::fromImage(message.data(), message.size());
+    /// auto x = file.getDataSet("x").read<std::vector<double>>();
+    /// \endcode
+    ///
+    /// \since 3.4
+    static File fromImage(const void* data, size_t size, AccessMode access_mode = ReadOnly);
+
+    ///
+    /// \brief Create a new file that exists only in memory.
+    ///
+    /// Uses the core driver without a backing store, growing the file in
+    /// steps of `increment` bytes. Once closed, the file is gone; obtain its
+    /// contents first, with `getImage`. If not empty, `name` must be unique
+    /// among the open files.
+    ///
+    /// \since 3.4
+    static File createInMemory(const std::string& name = "", size_t increment = 1 << 20);
+
+    ///
+    /// \brief Number of bytes of the file image, see `getImage`.
+    ///
+    /// \since 3.4
+    size_t getImageSize() const;
+
+    ///
+    /// \brief Copy the file image into `buffer`, which holds `size` bytes.
+    ///
+    /// The image is what the file would contain on disk after flushing, for
+    /// files in memory and on disk alike; it can be opened with `fromImage`.
+    /// Throws a `FileException` if `buffer` is too small.
+    ///
+    /// \return The number of bytes of the image.
+    ///
+    /// \since 3.4
+    size_t getImage(void* buffer, size_t size) const;
+
+    ///
+    /// \brief Return a copy of the file image.
+    ///
+    /// \since 3.4
+    std::vector<uint8_t> getImage() const;
+
+    ///
+    /// \brief Cache up to `capacity` opened datasets and groups by path.
+    ///
+    /// Every `getDataSet`, `getGroup`, `exist` and `getObjectType` resolves
+    /// its path through each group along the way. With the handle cache
+    /// enabled, `getDataSet` and `getGroup` remember the objects they open,
+    /// and looking up the same path again costs a hash lookup. The least
+    /// recently used object is closed once more than `capacity` objects are
+    /// cached. Only objects opened with the default access properties are
+    /// cached.
+    ///
+    /// Calling `unlink` or `rename` on this file drops all cached objects,
+    /// creating a dataset, group or link drops the objects at and below the
+    /// new path. Modifications made through a `Group`, or any other handle
+    /// to the same file, aren't observed; call `clearHandleCache` after them.
+    ///
+    /// The cache is shared with copies of this `File` made after enabling it,
+    /// and keeps the cached objects, and therefore the file, open until
+    /// the last of them is destroyed. It isn't thread-safe.
+    ///
+    /// \since 3.4
+    void enableHandleCache(size_t capacity = 1024);
+
+    ///
+    /// \brief Close all cached objects and stop caching.
+    ///
+    /// \since 3.4
+    void disableHandleCache() noexcept;
+
+    ///
+    /// \brief Close all cached objects.
+    ///
+    /// \since 3.4
+    void clearHandleCache() noexcept;
+
+    ///
+    /// \brief Number of lookups served from the handle cache.
+    ///
+    /// \since 3.4
+    size_t getHandleCacheHits() const noexcept;
+
+    ///
+    /// \brief Number of lookups not served from the handle cache.
+    ///
+    /// \since 3.4
+    size_t getHandleCacheMisses() const noexcept;
+
   protected:
     File() = default;
     using Object::Object;
 
   private:
     mutable std::string _filename{};
+    std::shared_ptr<details::HandleCache> _handle_cache;
 
     template <typename>
     friend class PathTraits;
+    friend struct details::HandleCacheAccess;
 };
 
 inline File::AccessMode operator|(File::AccessMode lhs, File::AccessMode rhs) {
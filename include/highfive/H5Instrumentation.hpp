@@ -0,0 +1,322 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/// \brief Set to `1` to record the I/O of HighFive, see `Instrumentation`.
+///
+/// Must be defined consistently before including any HighFive header. If `0`,
+/// the default, the instrumentation is compiled out completely.
+#ifndef HIGHFIVE_INSTRUMENTATION
+#define HIGHFIVE_INSTRUMENTATION 0
+#endif
+
+namespace HighFive {
+
+/// \brief The operations recorded by `Instrumentation`.
+///
+/// \since 3.4
+enum class IOOperation {
+    /// `H5Dread` or `H5Aread`.
+    Read,
+    /// `H5Dwrite` or `H5Awrite`.
+    Write,
+    /// Opening a file, dataset or group.
+    Open,
+    /// Creating a file, dataset or group.
+    Create,
+    /// Flushing a file.
+    Flush,
+    /// Selecting a part of a dataset.
+    Select,
+    /// Copying an object into the buffer passed to HDF5, e.g. nested vectors
+    /// or strings. Part of `Write`.
+    Serialize,
+    /// Copying the buffer filled by HDF5 into an object. Part of `Read`.
+    Unserialize
+};
+
+inline std::string to_string(IOOperation operation) {
+    switch (operation) {
+    case IOOperation::Read:
+        return "read";
+    case IOOperation::Write:
+        return "write";
+    case IOOperation::Open:
+        return "open";
+    case IOOperation::Create:
+        return "create";
+    case IOOperation::Flush:
+        return "flush";
+    case IOOperation::Select:
+        return "select";
+    case IOOperation::Serialize:
+        return "serialize";
+    case IOOperation::Unserialize:
+        return "unserialize";
+    default:
+        return "??";
+    }
+}
+
+/// \brief A single recorded operation.
+///
+/// \since 3.4
+struct IOEvent {
+    IOOperation operation;
+    /// Path of the object, for attributes the path of the object followed
+    /// by `@` and the name of the attribute, e.g. `/group/dset@units`. For
+    /// files, the name of the file.
+    std::string path;
+    /// Bytes transferred from or to memory, in the memory datatype.
+    size_t bytes;
+    /// Bytes copied through an intermediate buffer, e.g. to serialize
+    /// nested containers or strings.
+    size_t staged_bytes;
+    /// Whether HDF5 converts between the memory and file datatype.
+    bool converted;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::duration duration;
+    std::thread::id thread_id;
+};
+
+/// \brief Accumulated statistics of one operation on one object.
+///
+/// \since 3.4
+struct IOStatistics {
+    size_t n_calls = 0;
+    size_t bytes = 0;
+    size_t staged_bytes = 0;
+    size_t n_conversions = 0;
+    std::chrono::steady_clock::duration duration{0};
+
+    void add(const IOEvent& event) noexcept {
+        n_calls += 1;
+        bytes += event.bytes;
+        staged_bytes += event.staged_bytes;
+        n_conversions += size_t(event.converted);
+        duration += event.duration;
+    }
+};
+
+/// \brief Records reads, writes, opening and creating objects, and flushing.
+///
+/// For every object, the calls, bytes, time and staging copies are
+/// accumulated per operation and can be inspected with `snapshot`. Since
+/// `Serialize` and `Unserialize` are part of `Write` and `Read`, their time
+/// is counted twice, once separately and once as part of the transfer.
+/// Additionally, every event is passed to the callbacks, if any are set, e.g.
+/// to forward it to a profiler. Recording happens only if HighFive is
+/// compiled with `HIGHFIVE_INSTRUMENTATION=1`:
+///
+/// \code{.cpp}
+/// #define HIGHFIVE_INSTRUMENTATION 1
+/// #include <highfive/highfive.hpp>
+///
+/// // ...
+/// for (const auto& object: get_global_instrumentation().snapshot()) {
+///     const auto& reads = object.second.at(IOOperation::Read);
+///     std::cout << object.first << ": " << reads.bytes << " bytes read\n";
+/// }
+/// \endcode
+///
+/// Objects are identified by their path only, i.e. objects with the same path
+/// in different files share their statistics. All methods are thread-safe;
+/// the callbacks are called from the thread that performed the operation.
+///
+/// This is intended to be used as a singleton, via
+/// `get_global_instrumentation()`.
+///
+/// \since 3.4
+class Instrumentation {
+  public:
+    using callback_type = std::function<void(const IOEvent&)>;
+    using snapshot_type = std::map<std::string, std::map<IOOperation, IOStatistics>>;
+
+    Instrumentation() = default;
+    Instrumentation(const Instrumentation&) = delete;
+    Instrumentation& operator=(const Instrumentation&) = delete;
+
+    void record(const IOEvent& event) {
+        std::shared_ptr<const callback_list> callbacks;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _statistics[event.path][event.operation].add(event);
+            callbacks = _callbacks;
+        }
+
+        if (callbacks) {
+            for (const auto& callback: *callbacks) {
+                callback.second(event);
+            }
+        }
+    }
+
+    /// \brief A copy of the accumulated statistics, keyed by path.
+    snapshot_type snapshot() const {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _statistics;
+    }
+
+    /// \brief Forget the accumulated statistics.
+    void reset() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _statistics.clear();
+    }
+
+    /// \brief Call `cb` for every event; an empty `cb` removes the callback.
+    ///
+    /// Replaces the callback set previously, but not those added by
+    /// `add_callback`. Events recorded concurrently by other threads might
+    /// still be passed to the previous callback after `set_callback` returns.
+    void set_callback(callback_type cb) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        updateCallbacks(0, std::move(cb));
+    }
+
+    /// \brief Call `cb` for every event, in addition to the other callbacks.
+    ///
+    /// Returns the id to pass to `remove_callback`.
+    size_t add_callback(callback_type cb) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto id = _next_callback_id++;
+        updateCallbacks(id, std::move(cb));
+        return id;
+    }
+
+    /// \brief Stop calling the callback added with the id `id`.
+    ///
+    /// Like for `set_callback`, the callback might still be called by other
+    /// threads afterwards.
+    void remove_callback(size_t id) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        updateCallbacks(id, nullptr);
+    }
+
+  private:
+    using callback_list = std::vector<std::pair<size_t, callback_type>>;
+
+    // Replaces, adds or removes the callback `id`. The list is never modified
+    // in place, since `record` calls the callbacks without holding the lock.
+    void updateCallbacks(size_t id, callback_type cb) {
+        auto callbacks = std::make_shared<callback_list>();
+        if (_callbacks) {
+            for (const auto& callback: *_callbacks) {
+                if (callback.first != id) {
+                    callbacks->push_back(callback);
+                }
+            }
+        }
+        if (cb) {
+            callbacks->emplace_back(id, std::move(cb));
+            std::sort(callbacks->begin(),
+                      callbacks->end(),
+                      [](const callback_list::value_type& a, const callback_list::value_type& b) {
+                          return a.first < b.first;
+                      });
+        }
+
+        if (callbacks->empty()) {
+            _callbacks.reset();
+        } else {
+            _callbacks = std::move(callbacks);
+        }
+    }
+
+    mutable std::mutex _mutex;
+    snapshot_type _statistics;
+    std::shared_ptr<const callback_list> _callbacks;
+    size_t _next_callback_id = 1;
+};
+
+/// \brief Obtain a reference to the instrumentation used by HighFive.
+///
+/// \since 3.4
+inline Instrumentation& get_global_instrumentation() {
+    static Instrumentation instrumentation;
+    return instrumentation;
+}
+
+/// \brief Sets the callback that's called for every recorded event.
+///
+/// \since 3.4
+inline void register_instrumentation_callback(Instrumentation::callback_type cb) {
+    get_global_instrumentation().set_callback(std::move(cb));
+}
+
+namespace detail {
+
+/// \brief Records one event, from construction to destruction.
+class IOScope {
+  public:
+    IOScope(IOOperation operation,
+            std::string path,
+            size_t bytes = 0,
+            size_t staged_bytes = 0,
+            bool converted = false)
+        : _event{operation,
+                 std::move(path),
+                 bytes,
+                 staged_bytes,
+                 converted,
+                 std::chrono::steady_clock::now(),
+                 std::chrono::steady_clock::duration{0},
+                 std::this_thread::get_id()} {}
+
+    IOScope(const IOScope&) = delete;
+    IOScope& operator=(const IOScope&) = delete;
+
+    void addStagedBytes(size_t staged_bytes) noexcept {
+        _event.staged_bytes += staged_bytes;
+    }
+
+    ~IOScope() {
+        _event.duration = std::chrono::steady_clock::now() - _event.start;
+        try {
+            get_global_instrumentation().record(_event);
+        } catch (...) {
+            // Instrumentation must never break I/O.
+        }
+    }
+
+  private:
+    IOEvent _event;
+};
+
+/// \brief The path of `name` relative to the group at `parent`.
+inline std::string io_path(const std::string& parent, const std::string& name) {
+    if (!name.empty() && name[0] == '/') {
+        return name;
+    }
+    return parent == "/" ? "/" + name : parent + "/" + name;
+}
+
+}  // namespace detail
+
+#if HIGHFIVE_INSTRUMENTATION
+// Records the remainder of the enclosing scope as one event; the arguments
+// are passed to `detail::IOScope`.
+#define HIGHFIVE_INSTRUMENT(...) ::HighFive::detail::IOScope highfive_io_scope(__VA_ARGS__);
+
+// Adds staging copies to the event of the enclosing `HIGHFIVE_INSTRUMENT`.
+#define HIGHFIVE_INSTRUMENT_STAGED(staged_bytes) highfive_io_scope.addStagedBytes(staged_bytes);
+
+// Like `HIGHFIVE_INSTRUMENT`, for a block nested inside the scope of a
+// `HIGHFIVE_INSTRUMENT`.
+#define HIGHFIVE_INSTRUMENT_SPAN(...) ::HighFive::detail::IOScope highfive_io_span(__VA_ARGS__);
+#else
+#define HIGHFIVE_INSTRUMENT(...)                 ;
+#define HIGHFIVE_INSTRUMENT_STAGED(staged_bytes) ;
+#define HIGHFIVE_INSTRUMENT_SPAN(...)            ;
+#endif
+
+}  // namespace HighFive
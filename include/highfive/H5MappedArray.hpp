@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "H5DataSet.hpp"
+
+namespace HighFive {
+
+///
+/// \brief A read-only view of a dataset, backed by a memory mapping of the file.
+///
+/// Obtained from `DataSet::map`. The elements aren't copied; they're read by
+/// the OS, lazily and through the page cache, when they're first accessed.
+/// Hence, mapping a large dataset is almost free, independent of its size.
+///
+/// \code{.cpp}
+/// auto weights = file.getDataSet("weights").map<float>();
+/// float w = weights(i, j);  // Row-major, like the dataset.
+/// \endcode
+///
+/// The view stays valid for as long as the `MappedArray` exists, even after
+/// the dataset and file are closed. It shows the contents of the file at the
+/// time it was mapped; modifying the dataset while it's mapped, through
+/// HighFive or otherwise, is undefined behaviour.
+///
+/// \since 3.4
+template <class T>
+class MappedArray {
+  public:
+    using value_type = T;
+    using const_iterator = const T*;
+
+    ///
+    /// \brief An empty view.
+    MappedArray() = default;
+
+    MappedArray(const MappedArray&) = delete;
+    MappedArray& operator=(const MappedArray&) = delete;
+
+    MappedArray(MappedArray&& other) noexcept;
+    MappedArray& operator=(MappedArray&& other) noexcept;
+
+    ~MappedArray();
+
+    ///
+    /// \brief Pointer to the first element.
+    const T* data() const noexcept {
+        return _data;
+    }
+
+    ///
+    /// \brief Number of elements.
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    ///
+    /// \brief The dimensions of the dataset.
+    const std::vector<size_t>& getDimensions() const noexcept {
+        return _dims;
+    }
+
+    ///
+    /// \brief The `i`-th element, in row-major order.
+    const T& operator[](size_t i) const noexcept {
+        return _data[i];
+    }
+
+    ///
+    /// \brief The element at the multi-index `index`.
+    ///
+    /// The number of indices must match the number of dimensions.
+    template <class... Index>
+    const T& operator()(Index... index) const noexcept;
+
+    const_iterator begin() const noexcept {
+        return _data;
+    }
+
+    const_iterator end() const noexcept {
+        return _data + _size;
+    }
+
+  private:
+    MappedArray(void* mapping, size_t mapping_size, const T* data, std::vector<size_t> dims);
+
+    // Unmaps the file, unless moved from; errors are logged.
+    void release() noexcept;
+
+    void* _mapping = nullptr;
+    size_t _mapping_size = 0;
+    const T* _data = nullptr;
+    size_t _size = 0;
+    std::vector<size_t> _dims;
+
+    friend class DataSet;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5MappedArray_misc.hpp"
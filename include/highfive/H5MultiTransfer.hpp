@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5DataSpace.hpp"
+#include "H5DataType.hpp"
+#include "H5Instrumentation.hpp"
+#include "H5PropertyList.hpp"
+#include "H5Selection.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// One read or write queued in a `MultiTransfer`.
+class PendingTransfer {
+  public:
+    PendingTransfer(IOOperation operation_,
+                    const DataSet& dataset_,
+                    const DataType& mem_datatype_,
+                    const DataSpace& file_space_,
+                    const DataSpace& mem_space_)
+        : operation(operation_)
+        , dataset(dataset_)
+        , mem_datatype(mem_datatype_)
+        , file_space(file_space_)
+        , mem_space(mem_space_) {}
+
+    virtual ~PendingTransfer() = default;
+
+    // The buffer passed to HDF5.
+    virtual void* getPointer() = 0;
+
+    // Copies the values read into the container of the caller.
+    virtual void finish(const DataTransferProps& /* xfer_props */) {}
+
+    IOOperation operation;
+    DataSet dataset;
+    DataType mem_datatype;
+    DataSpace file_space;
+    DataSpace mem_space;
+
+    // Reported to the instrumentation.
+    size_t n_bytes = 0;
+    size_t n_staged_bytes = 0;
+    bool is_converted = false;
+};
+
+}  // namespace details
+
+///
+/// \brief Read or write many datasets with a single call to HDF5.
+///
+/// Writing many small datasets, one `DataSet::write` at a time, costs one
+/// `H5Dwrite` each; with MPI-IO every one of them is a separate collective
+/// operation. A `MultiTransfer` collects reads and writes of datasets, or of
+/// selections, of any type and issues them together:
+///
+/// \code{.cpp}
+/// auto transfer = MultiTransfer(xfer_props);
+/// transfer.write(file.getDataSet("x"), x);
+/// transfer.write(file.getDataSet("ids"), ids);
+/// transfer.read(file.getDataSet("mass").select({0}, {n}), mass);
+/// transfer.execute();
+/// \endcode
+///
+/// Reads and writes are issued in the order in which they were queued. With
+/// HDF5 1.14 or later, consecutive writes are issued by `H5Dwrite_multi` and
+/// consecutive reads by `H5Dread_multi`; otherwise they're issued one after
+/// the other. HDF5 requires that all datasets of one such call belong to the
+/// same file and that none appears twice. Therefore, the queue is split, in
+/// order, into batches of consecutive writes, or reads, that satisfy both;
+/// each batch is one call to HDF5. Queuing the writes, and the reads, of one
+/// file next to each other, and each dataset once, results in the fewest
+/// calls.
+///
+/// Values to be written are copied, if needed, when `write` is called;
+/// otherwise HDF5 reads them from the container passed to `write`, which
+/// must not change until `execute` returns. Containers passed to `read` are
+/// resized immediately and filled by `execute`; they must outlive the call
+/// to `execute`. If `execute` throws, the containers of the reads issued
+/// before the failing call have been filled.
+///
+/// \since 3.4
+class MultiTransfer {
+  public:
+    explicit MultiTransfer(const DataTransferProps& xfer_props = DataTransferProps());
+
+    MultiTransfer(const MultiTransfer&) = delete;
+    MultiTransfer& operator=(const MultiTransfer&) = delete;
+    MultiTransfer(MultiTransfer&&) = default;
+    MultiTransfer& operator=(MultiTransfer&&) = default;
+
+    ///
+    /// \brief Queue writing `buffer` to all of `dataset`.
+    template <class T>
+    void write(const DataSet& dataset, const T& buffer);
+
+    ///
+    /// \brief Queue writing `buffer` to `selection`.
+    template <class T>
+    void write(const Selection& selection, const T& buffer);
+
+    // The values might not be copied before `execute`.
+    template <class T>
+    void write(const DataSet& dataset, const T&& buffer) = delete;
+
+    template <class T>
+    void write(const Selection& selection, const T&& buffer) = delete;
+
+    ///
+    /// \brief Queue reading all of `dataset` into `array`.
+    template <class T>
+    void read(const DataSet& dataset, T& array);
+
+    ///
+    /// \brief Queue reading `selection` into `array`.
+    template <class T>
+    void read(const Selection& selection, T& array);
+
+    ///
+    /// \brief Number of queued reads and writes.
+    size_t size() const noexcept {
+        return _queue.size();
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    ///
+    /// \brief Issue all queued reads and writes, in order.
+    ///
+    /// Afterwards the queue is empty, even if an exception was thrown.
+    void execute();
+
+  private:
+    using queue_type = std::vector<std::unique_ptr<details::PendingTransfer>>;
+
+    template <class Slice, class T>
+    void queueWrite(const Slice& slice, const T& buffer);
+
+    template <class Slice, class T>
+    void queueRead(const Slice& slice, T& array);
+
+    // The end of the batch of transfers that starts at `begin`.
+    static size_t findBatchEnd(const queue_type& queue, size_t begin);
+
+    void transferBatch(queue_type& queue, size_t begin, size_t end) const;
+    void finishBatch(queue_type& queue, size_t begin, size_t end) const;
+
+    DataTransferProps _xfer_props;
+    queue_type _queue;
+};
+
+}  // namespace HighFive
+
+#include "bits/H5MultiTransfer_misc.hpp"
@@ -347,6 +347,29 @@ class MetadataBlockSize {
     hsize_t _size;
 };
 
+///
+/// \brief Keep the entire file in memory, using the core driver.
+///
+/// The file grows in steps of `increment` bytes. If `backing_store` is
+/// `true`, the file is written to disk when it's closed; otherwise it only
+/// ever exists in memory. See `H5Pset_fapl_core`.
+///
+/// \since 3.4
+class CoreDriver {
+  public:
+    explicit CoreDriver(size_t increment = 1 << 20, bool backing_store = false);
+    explicit CoreDriver(const FileAccessProps& fapl);
+
+    size_t getIncrement() const;
+    bool hasBackingStore() const;
+
+  private:
+    friend FileAccessProps;
+    void apply(hid_t list) const;
+    size_t _increment;
+    bool _backing_store;
+};
+
 #if H5_VERSION_GE(1, 10, 1)
 ///
 /// \brief Configure the file space strategy.
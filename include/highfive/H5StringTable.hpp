@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#if HIGHFIVE_CXX_STD >= 17
+#include <string_view>
+#endif
+
+namespace HighFive {
+
+template <typename Derivate>
+class SliceTraits;
+
+///
+/// \brief Strings read from a dataset, stored back-to-back in one buffer.
+///
+/// Reading a string dataset into `std::vector<std::string>` allocates every
+/// string several times: HDF5 allocates each variable-length string, which
+/// is then copied into its own `std::string` and finally freed again. A
+/// `StringTable` stores all characters in a single contiguous buffer and the
+/// start of every string in an array of offsets:
+///
+/// \code{.cpp}
+/// auto names = StringTable();
+/// dset.read(names);
+///
+/// for (size_t i = 0; i < names.size(); ++i) {
+///     std::string_view name = names[i];  // C++17; otherwise `names.c_str(i)`.
+/// }
+/// \endcode
+///
+/// When reading variable-length strings, HDF5 allocates the strings from a
+/// memory arena owned by the read, rather than with `malloc`, and the strings
+/// are then copied into the table in a single pass. Reusing a `StringTable`
+/// for consecutive reads reuses its memory.
+///
+/// Every string is followed by a `'\0'`, which isn't part of its length.
+/// Strings are in row-major order of the selection; the table doesn't
+/// preserve the shape, other than through `getDimensions`.
+///
+/// \since 3.4
+class StringTable {
+  public:
+    StringTable() = default;
+
+    ///
+    /// \brief Number of strings.
+    size_t size() const noexcept {
+        return _offsets.size() - 1;
+    }
+
+    bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    ///
+    /// \brief The dimensions of the selection that was read.
+    const std::vector<size_t>& getDimensions() const noexcept {
+        return _dims;
+    }
+
+    ///
+    /// \brief The `i`-th string, null-terminated.
+    const char* c_str(size_t i) const noexcept {
+        return _chars.data() + _offsets[i];
+    }
+
+    ///
+    /// \brief Length of the `i`-th string in bytes, without the `'\0'`.
+    size_t length(size_t i) const noexcept {
+        return _offsets[i + 1] - _offsets[i] - 1;
+    }
+
+    ///
+    /// \brief A copy of the `i`-th string.
+    std::string str(size_t i) const {
+        return std::string(c_str(i), length(i));
+    }
+
+#if HIGHFIVE_CXX_STD >= 17
+    ///
+    /// \brief A view of the `i`-th string.
+    std::string_view operator[](size_t i) const noexcept {
+        return std::string_view(c_str(i), length(i));
+    }
+#endif
+
+    ///
+    /// \brief All strings, each followed by a `'\0'`.
+    const std::vector<char>& chars() const noexcept {
+        return _chars;
+    }
+
+    ///
+    /// \brief The offset of every string in `chars()`; followed by the size of `chars()`.
+    const std::vector<size_t>& offsets() const noexcept {
+        return _offsets;
+    }
+
+    ///
+    /// \brief Remove all strings; the memory is kept.
+    void clear() noexcept {
+        _chars.clear();
+        _offsets.assign(1, 0);
+        _dims.clear();
+    }
+
+  private:
+    std::vector<char> _chars;
+    std::vector<size_t> _offsets = std::vector<size_t>(1, 0);
+    std::vector<size_t> _dims;
+
+    template <typename Derivate>
+    friend class SliceTraits;
+};
+
+}  // namespace HighFive
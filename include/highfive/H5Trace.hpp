@@ -0,0 +1,147 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "H5Exception.hpp"
+#include "H5Instrumentation.hpp"
+#include "H5Utility.hpp"
+
+namespace HighFive {
+
+///
+/// \brief Writes the operations of HighFive to a Chrome Trace Event file.
+///
+/// While the tracer exists, every event recorded by the `Instrumentation`
+/// is written as one span, with the path of the object, its thread and the
+/// number of bytes transferred. The file can be viewed in Perfetto or
+/// `chrome://tracing`:
+///
+/// \code{.cpp}
+/// #define HIGHFIVE_INSTRUMENTATION 1
+/// #include <highfive/highfive.hpp>
+///
+/// {
+///     ChromeTracer tracer("highfive.trace.json");
+///     // ...
+/// }  // The trace is complete when the tracer is destroyed.
+/// \endcode
+///
+/// Nothing is recorded unless HighFive is compiled with
+/// `HIGHFIVE_INSTRUMENTATION=1`. The tracer adds a callback to the global
+/// instrumentation, see `Instrumentation::add_callback`; several tracers
+/// may exist at the same time, each writes all events. Events that other
+/// threads record while the tracer is destroyed are dropped.
+///
+/// \since 3.4
+class ChromeTracer {
+  public:
+    explicit ChromeTracer(const std::string& filename)
+        : _trace(std::make_shared<Trace>(filename)) {
+        auto trace = _trace;
+        _callback_id = get_global_instrumentation().add_callback(
+            [trace](const IOEvent& event) { trace->write(event); });
+    }
+
+    ChromeTracer(const ChromeTracer&) = delete;
+    ChromeTracer& operator=(const ChromeTracer&) = delete;
+
+    ~ChromeTracer() {
+        get_global_instrumentation().remove_callback(_callback_id);
+
+        try {
+            _trace->close();
+        } catch (const std::exception& err) {
+            HIGHFIVE_LOG_ERROR(std::string("Failed to write the trace: ") + err.what());
+        }
+    }
+
+    /// \brief The number of spans written so far.
+    size_t getNumberOfEvents() const {
+        std::lock_guard<std::mutex> lock(_trace->mutex);
+        return _trace->n_events;
+    }
+
+  private:
+    // Shared with the callback, which other threads might still be calling
+    // while the tracer is destroyed.
+    struct Trace {
+        explicit Trace(const std::string& filename)
+            : out(filename)
+            , origin(std::chrono::steady_clock::now()) {
+            if (!out) {
+                throw FileException("Unable to open trace file " + filename);
+            }
+            out << "{\"traceEvents\":[";
+        }
+
+        void write(const IOEvent& event) {
+            using microseconds = std::chrono::duration<double, std::micro>;
+
+            std::ostringstream span;
+            span << std::fixed << std::setprecision(3);
+            span << "{\"name\":\"" << to_string(event.operation)
+                 << "\",\"cat\":\"highfive\",\"ph\":\"X\",\"ts\":"
+                 << microseconds(event.start - origin).count()
+                 << ",\"dur\":" << microseconds(event.duration).count() << ",\"pid\":1";
+            auto args = std::string(",\"args\":{\"path\":") + quote(event.path) +
+                        ",\"bytes\":" + std::to_string(event.bytes) +
+                        ",\"staged_bytes\":" + std::to_string(event.staged_bytes) +
+                        ",\"converted\":" + (event.converted ? "true" : "false") + "}}";
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (is_closed) {
+                return;
+            }
+            // Threads are numbered in the order of their first event.
+            auto tid = tids.emplace(event.thread_id, tids.size() + 1).first->second;
+            out << (n_events == 0 ? "\n" : ",\n") << span.str() << ",\"tid\":" << tid << args;
+            ++n_events;
+        }
+
+        void close() {
+            std::lock_guard<std::mutex> lock(mutex);
+            is_closed = true;
+            out << "\n]}\n";
+            out.close();
+        }
+
+        std::mutex mutex;
+        std::ofstream out;
+        std::chrono::steady_clock::time_point origin;
+        std::unordered_map<std::thread::id, size_t> tids;
+        size_t n_events = 0;
+        bool is_closed = false;
+    };
+
+    static std::string quote(const std::string& s) {
+        std::ostringstream out;
+        out << '"';
+        for (char c: s) {
+            if (c == '"' || c == '\\') {
+                out << '\\' << c;
+            } else if (static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                out << escaped;
+            } else {
+                out << c;
+            }
+        }
+        out << '"';
+        return out.str();
+    }
+
+    std::shared_ptr<Trace> _trace;
+    size_t _callback_id = 0;
+};
+
+}  // namespace HighFive
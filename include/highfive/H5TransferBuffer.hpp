@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace HighFive {
+
+namespace details {
+struct TransferBufferAccess;
+}  // namespace details
+
+///
+/// \brief Reusable scratch memory for reading and writing datasets.
+///
+/// Objects that aren't trivially copyable, e.g. `std::vector<std::vector<double>>`,
+/// are copied into (or out of) a contiguous intermediate buffer when reading
+/// or writing. By default this buffer is allocated and freed on every call.
+/// When the same `TransferBuffer` is passed to consecutive calls of
+/// `read`/`write`, its memory is reused and only grows when a larger
+/// selection is transferred.
+///
+/// \code{.cpp}
+/// auto transfer_buffer = TransferBuffer();
+/// auto blocks = std::vector<std::vector<double>>{};
+/// for (const auto& slab: slabs) {
+///     dset.select(slab).read(blocks, transfer_buffer);
+/// }
+/// \endcode
+///
+/// A `TransferBuffer` must not be used by multiple threads concurrently.
+///
+/// \since 3.4
+class TransferBuffer {
+  public:
+    TransferBuffer() = default;
+
+    ///
+    /// \brief Create a buffer with `n_bytes` of preallocated memory.
+    explicit TransferBuffer(size_t n_bytes) {
+        reserve(n_bytes);
+    }
+
+    ///
+    /// \brief Ensure that at least `n_bytes` are allocated.
+    void reserve(size_t n_bytes) {
+        if (n_bytes > _capacity) {
+            auto n_words = (n_bytes + sizeof(word_type) - 1) / sizeof(word_type);
+            // The old memory is kept if the allocation throws.
+            auto storage = std::unique_ptr<word_type[]>(new word_type[n_words]);
+            _storage.swap(storage);
+            _capacity = n_words * sizeof(word_type);
+            _n_allocations += 1;
+        }
+    }
+
+    ///
+    /// \brief Number of bytes currently allocated.
+    size_t capacity() const noexcept {
+        return _capacity;
+    }
+
+    ///
+    /// \brief Free the allocated memory.
+    void release() noexcept {
+        _storage.reset();
+        _capacity = 0;
+    }
+
+    ///
+    /// \brief Total number of bytes that were staged in this buffer.
+    size_t getStagedBytes() const noexcept {
+        return _n_staged_bytes;
+    }
+
+    ///
+    /// \brief Number of times memory was (re-)allocated.
+    size_t getAllocationCount() const noexcept {
+        return _n_allocations;
+    }
+
+    ///
+    /// \brief Reset the staged bytes and allocation counters to zero.
+    void resetStatistics() noexcept {
+        _n_staged_bytes = 0;
+        _n_allocations = 0;
+    }
+
+  private:
+    using word_type = std::max_align_t;
+
+    // Returns uninitialized memory for `n` elements of type `T`.
+    template <class T>
+    T* allocate(size_t n) {
+        static_assert(std::is_trivially_copyable<T>::value,
+                      "Only trivially copyable elements can be staged.");
+        static_assert(alignof(T) <= alignof(word_type), "Overaligned elements can't be staged.");
+
+        reserve(n * sizeof(T));
+        _n_staged_bytes += n * sizeof(T);
+        return reinterpret_cast<T*>(_storage.get());
+    }
+
+    friend struct details::TransferBufferAccess;
+
+    std::unique_ptr<word_type[]> _storage;
+    size_t _capacity = 0;
+    size_t _n_staged_bytes = 0;
+    size_t _n_allocations = 0;
+};
+
+namespace details {
+
+struct TransferBufferAccess {
+    template <class T>
+    static T* allocate(TransferBuffer& transfer_buffer, size_t n) {
+        return transfer_buffer.template allocate<T>(n);
+    }
+};
+
+}  // namespace details
+}  // namespace HighFive
@@ -0,0 +1,288 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "H5Attribute.hpp"
+#include "H5DataSet.hpp"
+#include "H5PropertyList.hpp"
+#include "H5Selection.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// Calls `f` and destroys it before the result is made available. Otherwise,
+// the caller could proceed while `f` still releases HDF5 handles it owns.
+template <class F, class R>
+void run_async_request(std::shared_ptr<F>& f, std::promise<R>& promise) {
+    try {
+        auto result = (*f)();
+        f.reset();
+        promise.set_value(std::move(result));
+    } catch (...) {
+        f.reset();
+        promise.set_exception(std::current_exception());
+    }
+}
+
+template <class F>
+void run_async_request(std::shared_ptr<F>& f, std::promise<void>& promise) {
+    try {
+        (*f)();
+        f.reset();
+        promise.set_value();
+    } catch (...) {
+        f.reset();
+        promise.set_exception(std::current_exception());
+    }
+}
+
+}  // namespace details
+
+///
+/// \brief A dedicated I/O thread executing HDF5 requests one after the other.
+///
+/// `readAsync` and `writeAsync` of a `DataSet`, `Selection` or `Attribute`
+/// return immediately with an `std::future`, while the request is executed on
+/// the I/O thread of `AsyncIOQueue::getDefault()`. Requests are executed in
+/// the order they were submitted. The queue is bounded: if `getCapacity()`
+/// requests are pending, submitting another one blocks until the I/O thread
+/// catches up. Exceptions thrown by a request are rethrown by the future's
+/// `get`.
+///
+/// \code{.cpp}
+/// auto done = writeAsync(dset, std::move(state));  // no copy of `state`.
+/// compute_next_step();
+/// done.get();
+/// \endcode
+///
+/// Unless HDF5 was built thread-safe, HDF5 must not be called concurrently
+/// from several threads. While executing a request, the I/O thread holds the
+/// lock returned by `AsyncIOQueue::lock()`. Any other thread that uses HighFive
+/// while requests are pending must hold this lock, or first wait for the
+/// requests to complete, see `wait()`.
+///
+/// This header isn't included by `highfive.hpp`. It starts a thread, hence
+/// it requires linking with the threading library, e.g. `Threads::Threads`.
+///
+/// \since 3.4
+class AsyncIOQueue {
+  public:
+    ///
+    /// \brief Start the I/O thread, allowing `capacity` pending requests.
+    explicit AsyncIOQueue(size_t capacity = 16)
+        : _capacity(capacity == 0 ? 1 : capacity)
+        , _thread([this]() { work(); }) {
+        // Constructs the mutex before this queue completes its construction.
+        // Hence, a static queue, e.g. `getDefault()`, is destroyed, and its
+        // pending requests completed, before the mutex.
+        (void) hdf5_mutex();
+    }
+
+    AsyncIOQueue(const AsyncIOQueue&) = delete;
+    AsyncIOQueue& operator=(const AsyncIOQueue&) = delete;
+
+    ///
+    /// \brief Complete all pending requests and stop the I/O thread.
+    ~AsyncIOQueue() {
+        {
+            std::lock_guard<std::mutex> guard(_mutex);
+            _stop = true;
+        }
+        _not_empty.notify_all();
+        _thread.join();
+    }
+
+    ///
+    /// \brief The queue used by `readAsync` and `writeAsync`.
+    static AsyncIOQueue& getDefault() {
+        static AsyncIOQueue queue;
+        return queue;
+    }
+
+    ///
+    /// \brief Exclude the I/O threads from calling HDF5 while the lock is held.
+    ///
+    /// Don't submit requests while holding the lock: if the queue is full,
+    /// `submit` waits for the I/O thread, which waits for the lock.
+    static std::unique_lock<std::recursive_mutex> lock() {
+        return std::unique_lock<std::recursive_mutex>(hdf5_mutex());
+    }
+
+    ///
+    /// \brief Enqueue `f` to be called on the I/O thread.
+    ///
+    /// Blocks while the queue is full. `f` is destroyed on the I/O thread,
+    /// while holding the HDF5 lock and before the future becomes ready.
+    template <class F>
+    std::future<decltype(std::declval<F&>()())> submit(F&& f) {
+        using result_type = decltype(std::declval<F&>()());
+        using function_type = typename std::decay<F>::type;
+
+        auto promise = std::make_shared<std::promise<result_type>>();
+        auto function = std::make_shared<function_type>(std::forward<F>(f));
+        auto future = promise->get_future();
+        {
+            std::unique_lock<std::mutex> guard(_mutex);
+            _not_full.wait(guard, [this]() { return _requests.size() < _capacity; });
+            _requests.emplace_back([promise, function]() mutable {
+                details::run_async_request(function, *promise);
+            });
+        }
+        _not_empty.notify_one();
+
+        return future;
+    }
+
+    ///
+    /// \brief Block until all submitted requests have completed.
+    void wait() {
+        std::unique_lock<std::mutex> guard(_mutex);
+        _idle.wait(guard, [this]() { return _requests.empty() && !_is_busy; });
+    }
+
+    ///
+    /// \brief Maximum number of pending requests.
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    ///
+    /// \brief Number of requests that haven't been started.
+    size_t size() const {
+        std::lock_guard<std::mutex> guard(_mutex);
+        return _requests.size();
+    }
+
+  private:
+    static std::recursive_mutex& hdf5_mutex() {
+        static std::recursive_mutex mutex;
+        return mutex;
+    }
+
+    void work() {
+        while (true) {
+            std::function<void()> request;
+            {
+                std::unique_lock<std::mutex> guard(_mutex);
+                _not_empty.wait(guard, [this]() { return _stop || !_requests.empty(); });
+                if (_requests.empty()) {
+                    return;
+                }
+
+                request = std::move(_requests.front());
+                _requests.pop_front();
+                _is_busy = true;
+            }
+            _not_full.notify_one();
+
+            {
+                auto hdf5_lock = lock();
+                request();
+                request = nullptr;
+            }
+
+            {
+                std::lock_guard<std::mutex> guard(_mutex);
+                _is_busy = false;
+            }
+            _idle.notify_all();
+        }
+    }
+
+    size_t _capacity;
+    std::deque<std::function<void()>> _requests;
+    mutable std::mutex _mutex;
+    std::condition_variable _not_empty;
+    std::condition_variable _not_full;
+    std::condition_variable _idle;
+    bool _is_busy = false;
+    bool _stop = false;
+    std::thread _thread;
+};
+
+///
+/// \brief Read the entire dataset or selection on the I/O thread.
+///
+/// Returns immediately; the value is available from the returned future
+/// once the request completed. See `AsyncIOQueue`.
+///
+/// \since 3.4
+template <typename T, typename Derivate>
+std::future<T> readAsync(const SliceTraits<Derivate>& slice,
+                         const DataTransferProps& xfer_props = DataTransferProps());
+
+///
+/// \brief Read the entire dataset or selection into `array` on the I/O thread.
+///
+/// The `array` isn't copied. It must stay alive and mustn't be accessed
+/// until the returned future is ready. See `AsyncIOQueue`.
+///
+/// \since 3.4
+template <typename Derivate, typename T>
+std::future<void> readAsync(const SliceTraits<Derivate>& slice,
+                            T& array,
+                            const DataTransferProps& xfer_props = DataTransferProps());
+
+///
+/// \brief Write `buffer` to the dataset or selection on the I/O thread.
+///
+/// Returns immediately; the returned future is ready once the data was
+/// written. See `AsyncIOQueue`.
+///
+/// The request owns `buffer`: pass an rvalue, e.g. `std::move(values)`, to
+/// avoid copying it. Alternatively, pass `std::cref(values)` if `values`
+/// is guaranteed to stay alive and unchanged until the future is ready;
+/// then no copy is made either.
+///
+/// \since 3.4
+template <typename Derivate, typename T>
+std::future<void> writeAsync(const SliceTraits<Derivate>& slice,
+                             T buffer,
+                             const DataTransferProps& xfer_props = DataTransferProps());
+
+///
+/// \brief Get the value of the attribute on the I/O thread.
+///
+/// Returns immediately; the value is available from the returned future
+/// once the request completed. See `AsyncIOQueue`.
+///
+/// \since 3.4
+template <typename T>
+std::future<T> readAsync(const Attribute& attr);
+
+///
+/// \brief Read the attribute into `array` on the I/O thread.
+///
+/// The `array` isn't copied. It must stay alive and mustn't be accessed
+/// until the returned future is ready. See `AsyncIOQueue`.
+///
+/// \since 3.4
+template <typename T>
+std::future<void> readAsync(const Attribute& attr, T& array);
+
+///
+/// \brief Write `value` into the attribute on the I/O thread.
+///
+/// Returns immediately; the returned future is ready once the value was
+/// written. The request owns `value`; pass `std::move(value)` or, if
+/// `value` stays alive and unchanged until the future is ready,
+/// `std::cref(value)` to avoid a copy. See `AsyncIOQueue`.
+///
+/// \since 3.4
+template <typename T>
+std::future<void> writeAsync(const Attribute& attr, T value);
+
+}  // namespace HighFive
+
+#include "bits/async_io_misc.hpp"
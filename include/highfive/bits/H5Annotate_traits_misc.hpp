@@ -37,7 +37,7 @@ template <typename Derivate>
 template <typename Type>
 inline Attribute AnnotateTraits<Derivate>::createAttribute(const std::string& attribute_name,
                                                            const DataSpace& space) {
-    return createAttribute(attribute_name, space, create_and_check_datatype<Type>());
+    return createAttribute(attribute_name, space, details::DataTypeCache::getChecked<Type>());
 }
 
 template <typename Derivate>
@@ -47,7 +47,8 @@ inline Attribute AnnotateTraits<Derivate>::createAttribute(const std::string& at
     Attribute att =
         createAttribute(attribute_name,
                         DataSpace::From(data),
-                        create_and_check_datatype<typename details::inspector<T>::base_type>());
+                        details::DataTypeCache::getChecked<
+                            typename details::inspector<T>::base_type>());
     att.write(data);
     return att;
 }
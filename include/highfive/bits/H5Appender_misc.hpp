@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <string>
+
+#include "h5p_wrapper.hpp"
+#include "compute_total_size.hpp"
+#include "H5Inspector_misc.hpp"
+#include "H5Utils.hpp"
+#include "../H5DataSpace.hpp"
+#include "../H5Exception.hpp"
+#include "../H5PropertyList.hpp"
+#include "../H5Utility.hpp"
+
+namespace HighFive {
+
+template <class T>
+inline Appender<T>::Appender(const DataSet& dataset, size_t rows_per_batch)
+    : _dataset(dataset) {
+    auto space = dataset.getSpace();
+    _dims = space.getDimensions();
+    _max_dims = space.getMaxDimensions();
+
+    if (_dims.empty()) {
+        throw DataSetException("Unable to append to the scalar dataset '" + dataset.getPath() +
+                               "'.");
+    }
+
+    auto create_props = dataset.getCreatePropertyList();
+    if (detail::h5p_get_layout(create_props.getId()) != H5D_CHUNKED) {
+        throw DataSetException("Unable to append to '" + dataset.getPath() +
+                               "': the dataset isn't chunked.");
+    }
+
+    auto chunk_rows = static_cast<size_t>(Chunking(create_props).getDimensions()[0]);
+    auto n_chunks = std::max(size_t(1), (rows_per_batch + chunk_rows - 1) / chunk_rows);
+
+    _row_size = compute_total_size(std::vector<size_t>(_dims.begin() + 1, _dims.end()));
+
+    // A row can't have more dimensions than the dataset without its first; a
+    // scalar only fills rows of one element.
+    const size_t min_ndim = details::inspector<T>::min_ndim;
+    const size_t max_ndim = details::inspector<T>::max_ndim;
+    if (min_ndim + 1 > _dims.size() || (max_ndim == 0 && _row_size != 1)) {
+        throw DataSpaceException("Unable to append rows of rank " + std::to_string(min_ndim) +
+                                 " to '" + dataset.getPath() + "' with dimensions " +
+                                 details::format_vector(_dims) + ".");
+    }
+    _batch_rows = n_chunks * chunk_rows;
+    _n_written = _dims[0];
+    _buffer.reserve(_batch_rows);
+}
+
+template <class T>
+inline Appender<T>::Appender(Appender&& other) noexcept
+    : _dataset(std::move(other._dataset))
+    , _dims(std::move(other._dims))
+    , _max_dims(std::move(other._max_dims))
+    , _row_size(other._row_size)
+    , _batch_rows(other._batch_rows)
+    , _n_written(other._n_written)
+    , _buffer(std::move(other._buffer))
+    , _is_owner(other._is_owner) {
+    other._is_owner = false;
+}
+
+template <class T>
+inline Appender<T>& Appender<T>::operator=(Appender&& other) {
+    if (this != &other) {
+        release();
+        _dataset = std::move(other._dataset);
+        _dims = std::move(other._dims);
+        _max_dims = std::move(other._max_dims);
+        _row_size = other._row_size;
+        _batch_rows = other._batch_rows;
+        _n_written = other._n_written;
+        _buffer = std::move(other._buffer);
+        _is_owner = other._is_owner;
+        other._is_owner = false;
+    }
+    return *this;
+}
+
+template <class T>
+inline Appender<T>::~Appender() {
+    release();
+}
+
+template <class T>
+inline void Appender<T>::append(const T& row) {
+    if (details::inspector<T>::ndim > 0) {
+        auto n_elements = compute_total_size(details::inspector<T>::getDimensions(row));
+        if (n_elements != _row_size) {
+            throw DataSpaceException("Unable to append a row of " + std::to_string(n_elements) +
+                                     " elements, expected " + std::to_string(_row_size) + ".");
+        }
+    }
+
+    _buffer.push_back(row);
+
+    auto end = _n_written + _buffer.size();
+    if (end % _batch_rows == 0) {
+        writeBuffer();
+    }
+}
+
+template <class T>
+template <class Iterator>
+inline void Appender<T>::append(Iterator first, Iterator last) {
+    for (; first != last; ++first) {
+        append(*first);
+    }
+}
+
+template <class T>
+inline void Appender<T>::flush() {
+    if (!_buffer.empty()) {
+        writeBuffer();
+    }
+
+    if (_dims[0] != _n_written) {
+        _dims[0] = _n_written;
+        _dataset.resize(_dims);
+    }
+}
+
+template <class T>
+inline size_t Appender<T>::size() const noexcept {
+    return _n_written + _buffer.size();
+}
+
+template <class T>
+inline size_t Appender<T>::getBufferedRows() const noexcept {
+    return _buffer.size();
+}
+
+template <class T>
+inline size_t Appender<T>::getBatchRows() const noexcept {
+    return _batch_rows;
+}
+
+template <class T>
+inline size_t Appender<T>::capacity() const noexcept {
+    return _dims[0];
+}
+
+template <class T>
+inline void Appender<T>::release() noexcept {
+    if (!_is_owner) {
+        return;
+    }
+
+    _is_owner = false;
+    try {
+        flush();
+    } catch (const std::exception& err) {
+        HIGHFIVE_LOG_ERROR("Failed to flush the rows appended to '" + _dataset.getPath() +
+                           "': " + err.what());
+    }
+}
+
+template <class T>
+inline void Appender<T>::writeBuffer() {
+    auto end = _n_written + _buffer.size();
+    if (end > _dims[0]) {
+        auto max_rows = _max_dims[0];
+        if (end > max_rows) {
+            throw DataSetException("Unable to append to '" + _dataset.getPath() +
+                                   "': exceeds the maximum of " + std::to_string(max_rows) +
+                                   " rows.");
+        }
+
+        auto n_rows = std::max(end, 2 * _dims[0]);
+        n_rows = (n_rows + _batch_rows - 1) / _batch_rows * _batch_rows;
+        if (max_rows != DataSpace::UNLIMITED) {
+            n_rows = std::min(n_rows, max_rows);
+        }
+
+        _dims[0] = n_rows;
+        _dataset.resize(_dims);
+    }
+
+    auto offset = std::vector<size_t>(_dims.size(), 0);
+    offset[0] = _n_written;
+    auto count = _dims;
+    count[0] = _buffer.size();
+
+    _dataset.select(offset, count).write(_buffer);
+    _n_written = end;
+    _buffer.clear();
+}
+
+template <class T>
+inline Appender<T> DataSet::appender(size_t rows_per_batch) const {
+    return Appender<T>(*this, rows_per_batch);
+}
+
+}  // namespace HighFive
@@ -18,6 +18,7 @@
 #include <H5Ppublic.h>
 
 #include "../H5DataSpace.hpp"
+#include "../H5Instrumentation.hpp"
 #include "H5Converter_misc.hpp"
 #include "H5Inspector_misc.hpp"
 #include "H5ReadWrite_misc.hpp"
@@ -88,10 +89,20 @@ inline void Attribute::read(T& array) const {
         return;
     }
 
+    HIGHFIVE_INSTRUMENT(IOOperation::Read,
+                        getPath() + "@" + getName(),
+                        mem_space.getElementCount() * buffer_info.data_type.getSize(),
+                        0,
+                        !(buffer_info.data_type == file_datatype))
     auto r = details::data_converter::get_reader<T>(dims, array, file_datatype);
-    read_raw(r.getPointer(), buffer_info.data_type);
-    // re-arrange results
-    r.unserialize(array);
+    HIGHFIVE_INSTRUMENT_STAGED(r.getStagedBytes())
+    // Not `read_raw`, which would record a second event.
+    detail::h5a_read(getId(), buffer_info.data_type.getId(), static_cast<void*>(r.getPointer()));
+    {
+        HIGHFIVE_INSTRUMENT_SPAN(IOOperation::Unserialize, getPath() + "@" + getName())
+        // re-arrange results
+        r.unserialize(array);
+    }
 
     auto t = buffer_info.data_type;
     auto c = t.getClass();
@@ -111,6 +122,11 @@ template <typename T>
 inline void Attribute::read_raw(T* array, const DataType& mem_datatype) const {
     static_assert(!std::is_const<T>::value,
                   "read() requires a non-const structure to read data into");
+    HIGHFIVE_INSTRUMENT(IOOperation::Read,
+                        getPath() + "@" + getName(),
+                        getMemSpace().getElementCount() * mem_datatype.getSize(),
+                        0,
+                        !(mem_datatype == getDataType()))
 
     detail::h5a_read(getId(), mem_datatype.getId(), static_cast<void*>(array));
 }
@@ -118,7 +134,7 @@ inline void Attribute::read_raw(T* array, const DataType& mem_datatype) const {
 template <typename T>
 inline void Attribute::read_raw(T* array) const {
     using element_type = typename details::inspector<T>::base_type;
-    const DataType& mem_datatype = create_and_check_datatype<element_type>();
+    const DataType mem_datatype = details::DataTypeCache::getChecked<element_type>();
 
     read_raw(array, mem_datatype);
 }
@@ -146,19 +162,34 @@ inline void Attribute::write(const T& buffer) {
            << buffer_info.getMaxRank() << "(max)";
         throw DataSpaceException(ss.str());
     }
-    auto w = details::data_converter::serialize<T>(buffer, dims, file_datatype);
-    write_raw(w.getPointer(), buffer_info.data_type);
+    HIGHFIVE_INSTRUMENT(IOOperation::Write,
+                        getPath() + "@" + getName(),
+                        mem_space.getElementCount() * buffer_info.data_type.getSize(),
+                        0,
+                        !(buffer_info.data_type == file_datatype))
+    auto w = [&]() {
+        HIGHFIVE_INSTRUMENT_SPAN(IOOperation::Serialize, getPath() + "@" + getName())
+        return details::data_converter::serialize<T>(buffer, dims, file_datatype);
+    }();
+    HIGHFIVE_INSTRUMENT_STAGED(w.getStagedBytes())
+    // Not `write_raw`, which would record a second event.
+    detail::h5a_write(getId(), buffer_info.data_type.getId(), w.getPointer());
 }
 
 template <typename T>
 inline void Attribute::write_raw(const T* buffer, const DataType& mem_datatype) {
+    HIGHFIVE_INSTRUMENT(IOOperation::Write,
+                        getPath() + "@" + getName(),
+                        getMemSpace().getElementCount() * mem_datatype.getSize(),
+                        0,
+                        !(mem_datatype == getDataType()))
     detail::h5a_write(getId(), mem_datatype.getId(), buffer);
 }
 
 template <typename T>
 inline void Attribute::write_raw(const T* buffer) {
     using element_type = typename details::inspector<T>::base_type;
-    const auto& mem_datatype = create_and_check_datatype<element_type>();
+    const auto mem_datatype = details::DataTypeCache::getChecked<element_type>();
 
     write_raw(buffer, mem_datatype);
 }
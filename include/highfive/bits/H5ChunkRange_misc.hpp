@@ -0,0 +1,143 @@
+#pragma once
+
+#include <algorithm>
+#include <string>
+
+#include "h5p_wrapper.hpp"
+#include "compute_total_size.hpp"
+#include "../H5Exception.hpp"
+#include "../H5PropertyList.hpp"
+
+namespace HighFive {
+
+inline ChunkRange::ChunkRange(const DataSet& dataset, size_t chunks_per_step)
+    : _dataset(dataset)
+    , _dims(dataset.getDimensions()) {
+    auto create_props = dataset.getCreatePropertyList();
+    if (detail::h5p_get_layout(create_props.getId()) != H5D_CHUNKED) {
+        throw DataSetException("Unable to iterate over the chunks of '" + dataset.getPath() +
+                               "': the dataset isn't chunked.");
+    }
+
+    if (chunks_per_step == 0) {
+        throw DataSetException("Invalid number of chunks per step: 0.");
+    }
+
+    auto chunking = Chunking(create_props);
+    const auto& chunk_dims = chunking.getDimensions();
+    _chunk_dims.assign(chunk_dims.begin(), chunk_dims.end());
+
+    auto rank = _dims.size();
+    _block_dims = _chunk_dims;
+    _n_blocks.resize(rank);
+    _size = 1;
+
+    auto remaining = chunks_per_step;
+    for (size_t k = rank; k > 0; --k) {
+        auto axis = k - 1;
+        auto n_chunks = (_dims[axis] + _chunk_dims[axis] - 1) / _chunk_dims[axis];
+        auto factor = std::max(size_t(1), std::min(remaining, n_chunks));
+
+        _block_dims[axis] *= factor;
+        _n_blocks[axis] = (_dims[axis] + _block_dims[axis] - 1) / _block_dims[axis];
+        _size *= _n_blocks[axis];
+
+        remaining = factor < n_chunks ? size_t(1) : remaining / factor;
+    }
+}
+
+inline ChunkRange::iterator ChunkRange::begin() const {
+    return iterator(this, 0);
+}
+
+inline ChunkRange::iterator ChunkRange::end() const {
+    return iterator(this, _size);
+}
+
+inline size_t ChunkRange::size() const {
+    return _size;
+}
+
+inline std::vector<size_t> ChunkRange::getOffset(size_t i) const {
+    auto rank = _dims.size();
+    auto offset = std::vector<size_t>(rank);
+    for (size_t k = rank; k > 0; --k) {
+        offset[k - 1] = (i % _n_blocks[k - 1]) * _block_dims[k - 1];
+        i /= _n_blocks[k - 1];
+    }
+    return offset;
+}
+
+inline std::vector<size_t> ChunkRange::getCount(size_t i) const {
+    auto count = getOffset(i);
+    for (size_t k = 0; k < count.size(); ++k) {
+        count[k] = std::min(_block_dims[k], _dims[k] - count[k]);
+    }
+    return count;
+}
+
+inline Selection ChunkRange::operator[](size_t i) const {
+    if (i >= _size) {
+        throw DataSetException("Chunk block " + std::to_string(i) + " out of range, only " +
+                               std::to_string(_size) + " blocks.");
+    }
+
+    return _dataset.select(getOffset(i), getCount(i));
+}
+
+inline const std::vector<size_t>& ChunkRange::getChunkDimensions() const {
+    return _chunk_dims;
+}
+
+inline const std::vector<size_t>& ChunkRange::getBlockDimensions() const {
+    return _block_dims;
+}
+
+inline size_t ChunkRange::getMaxElementCount() const {
+    if (_size == 0) {
+        return 0;
+    }
+
+    return compute_total_size(getCount(0));
+}
+
+inline ChunkRange::iterator::iterator(const ChunkRange* range, size_t index)
+    : _range(range)
+    , _index(index) {}
+
+inline Selection ChunkRange::iterator::operator*() const {
+    return (*_range)[_index];
+}
+
+inline ChunkRange::iterator& ChunkRange::iterator::operator++() {
+    ++_index;
+    return *this;
+}
+
+inline ChunkRange::iterator ChunkRange::iterator::operator++(int) {
+    auto copy = *this;
+    ++_index;
+    return copy;
+}
+
+inline bool ChunkRange::iterator::operator==(const iterator& other) const {
+    return _range == other._range && _index == other._index;
+}
+
+inline bool ChunkRange::iterator::operator!=(const iterator& other) const {
+    return !(*this == other);
+}
+
+inline std::vector<size_t> ChunkRange::iterator::getOffset() const {
+    return _range->getOffset(_index);
+}
+
+inline std::vector<size_t> ChunkRange::iterator::getCount() const {
+    return _range->getCount(_index);
+}
+
+inline ChunkRange DataSet::chunks(size_t chunks_per_step) const {
+    return ChunkRange(*this, chunks_per_step);
+}
+
+}  // namespace HighFive
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include "../H5Exception.hpp"
+#include "../H5Instrumentation.hpp"
+#include "H5Utils.hpp"
+
+namespace HighFive {
+
+inline CompiledSelection::CompiledSelection(const Selection& selection)
+    : _mem_space(selection.getMemSpace())
+    , _file_space(selection.getSpace())
+    , _dims(_file_space.getDimensions()) {}
+
+inline Selection CompiledSelection::bind(const DataSet& dataset) const {
+    HIGHFIVE_INSTRUMENT(IOOperation::Select, dataset.getPath())
+
+    auto dims = dataset.getDimensions();
+    if (dims != _dims) {
+        throw DataSpaceException("Unable to bind a selection of a dataset of dimensions " +
+                                 details::format_vector(_dims) + " to '" + dataset.getPath() +
+                                 "' of dimensions " + details::format_vector(dims) + ".");
+    }
+
+    return detail::make_selection(_mem_space, _file_space, dataset);
+}
+
+}  // namespace HighFive
@@ -8,10 +8,13 @@
  */
 #pragma once
 
+#include <cstring>
 #include <type_traits>
 
 #include "H5Inspector_misc.hpp"
+#include "../H5Allocator.hpp"
 #include "../H5DataType.hpp"
+#include "../H5TransferBuffer.hpp"
 
 namespace HighFive {
 namespace details {
@@ -59,25 +62,52 @@ struct ShallowCopyBuffer {
         /* nothing to do. */
     }
 
+    size_t getStagedBytes() const noexcept {
+        return 0;
+    }
+
   private:
     hdf5_type* ptr;
 };
 
+enum class BufferMode { Read, Write };
+
 template <class T>
 struct DeepCopyBuffer {
     using type = unqualified_t<T>;
     using hdf5_type = typename inspector<type>::hdf5_type;
 
-    explicit DeepCopyBuffer(const std::vector<size_t>& _dims)
-        : buffer(compute_total_size(_dims))
-        , dims(_dims) {}
+    ///
+    /// \brief Allocate a buffer for `dims`, reusing `transfer_buffer` if possible.
+    ///
+    /// If `transfer_buffer` is `nullptr` the buffer owns its memory. When
+    /// reading, every element is overwritten by `H5Dread`, hence the buffer
+    /// isn't initialized. When writing, it's zero-filled, such that padding
+    /// bytes written to the file don't depend on previous transfers.
+    DeepCopyBuffer(const std::vector<size_t>& _dims,
+                   BufferMode mode,
+                   TransferBuffer* transfer_buffer = nullptr)
+        : dims(_dims) {
+        auto n_elements = compute_total_size(_dims);
+        if (transfer_buffer != nullptr) {
+            ptr = allocate(*transfer_buffer,
+                           n_elements,
+                           mode,
+                           std::is_trivially_copyable<hdf5_type>());
+        } else {
+            allocate(n_elements, mode);
+        }
+    }
+
+    DeepCopyBuffer(const DeepCopyBuffer&) = delete;
+    DeepCopyBuffer(DeepCopyBuffer&&) = default;
 
     hdf5_type* getPointer() {
-        return buffer.data();
+        return ptr;
     }
 
     hdf5_type const* getPointer() const {
-        return buffer.data();
+        return ptr;
     }
 
     hdf5_type* begin() {
@@ -89,16 +119,46 @@ struct DeepCopyBuffer {
     }
 
     void unserialize(T& val) const {
-        inspector<type>::unserialize(buffer.data(), dims, val);
+        inspector<type>::unserialize(ptr, dims, val);
+    }
+
+    size_t getStagedBytes() const noexcept {
+        return compute_total_size(dims) * sizeof(hdf5_type);
     }
 
   private:
-    std::vector<hdf5_type> buffer;
-    std::vector<size_t> dims;
-};
+    hdf5_type* allocate(TransferBuffer& transfer_buffer,
+                        size_t n_elements,
+                        BufferMode mode,
+                        std::true_type) {
+        auto* staging = TransferBufferAccess::allocate<hdf5_type>(transfer_buffer, n_elements);
+        if (mode == BufferMode::Write) {
+            std::memset(static_cast<void*>(staging), 0, n_elements * sizeof(hdf5_type));
+        }
+        return staging;
+    }
 
-enum class BufferMode { Read, Write };
+    hdf5_type* allocate(TransferBuffer& /* transfer_buffer */,
+                        size_t n_elements,
+                        BufferMode /* mode */,
+                        std::false_type) {
+        return allocate(n_elements, BufferMode::Write);
+    }
 
+    hdf5_type* allocate(size_t n_elements, BufferMode mode) {
+        if (mode == BufferMode::Read) {
+            buffer.resize(n_elements);
+        } else {
+            buffer.resize(n_elements, hdf5_type());
+        }
+        ptr = buffer.data();
+        return ptr;
+    }
+
+    uninitialized_vector<hdf5_type> buffer;
+    hdf5_type* ptr = nullptr;
+    std::vector<size_t> dims;
+};
 
 ///
 /// \brief String length in bytes excluding the `\0`.
@@ -319,6 +379,17 @@ struct StringBuffer {
         inspector<type>::unserialize(begin(), dims, val);
     }
 
+    // The fixed-length buffer; or the array of pointers and the copies of
+    // strings that aren't null-terminated.
+    size_t getStagedBytes() const noexcept {
+        size_t n_bytes = fixed_length_buffer.size();
+        n_bytes += variable_length_pointers.size() * sizeof(char*);
+        for (const auto& s: variable_length_buffer) {
+            n_bytes += s.size();
+        }
+        return n_bytes;
+    }
+
   private:
     StringType file_datatype;
     StringPadding padding;
@@ -348,7 +419,8 @@ struct Writer<T, typename enable_shallow_copy<T>::type>: public ShallowCopyBuffe
   public:
     explicit Writer(const T& val,
                     const std::vector<size_t>& /* dims */,
-                    const DataType& /* file_datatype */)
+                    const DataType& /* file_datatype */,
+                    TransferBuffer* /* transfer_buffer */ = nullptr)
         : super(val) {};
 };
 
@@ -356,15 +428,19 @@ template <typename T>
 struct Writer<T, typename enable_deep_copy<T>::type>: public DeepCopyBuffer<T> {
     explicit Writer(const T& val,
                     const std::vector<size_t>& _dims,
-                    const DataType& /* file_datatype */)
-        : DeepCopyBuffer<T>(_dims) {
+                    const DataType& /* file_datatype */,
+                    TransferBuffer* transfer_buffer = nullptr)
+        : DeepCopyBuffer<T>(_dims, BufferMode::Write, transfer_buffer) {
         inspector<T>::serialize(val, _dims, this->begin());
     }
 };
 
 template <typename T>
 struct Writer<T, typename enable_string_copy<T>::type>: public StringBuffer<T, BufferMode::Write> {
-    explicit Writer(const T& val, const std::vector<size_t>& _dims, const DataType& _file_datatype)
+    explicit Writer(const T& val,
+                    const std::vector<size_t>& _dims,
+                    const DataType& _file_datatype,
+                    TransferBuffer* /* transfer_buffer */ = nullptr)
         : StringBuffer<T, BufferMode::Write>(_dims, _file_datatype) {
         inspector<T>::serialize(val, _dims, this->begin());
     }
@@ -380,7 +456,10 @@ struct Reader<T, typename enable_shallow_copy<T>::type>: public ShallowCopyBuffe
     using type = typename super::type;
 
   public:
-    Reader(const std::vector<size_t>&, type& val, const DataType& /* file_datatype */)
+    Reader(const std::vector<size_t>&,
+           type& val,
+           const DataType& /* file_datatype */,
+           TransferBuffer* /* transfer_buffer */ = nullptr)
         : super(val) {}
 };
 
@@ -391,8 +470,11 @@ struct Reader<T, typename enable_deep_copy<T>::type>: public DeepCopyBuffer<T> {
     using type = typename super::type;
 
   public:
-    Reader(const std::vector<size_t>& _dims, type&, const DataType& /* file_datatype */)
-        : super(_dims) {}
+    Reader(const std::vector<size_t>& _dims,
+           type&,
+           const DataType& /* file_datatype */,
+           TransferBuffer* transfer_buffer = nullptr)
+        : super(_dims, BufferMode::Read, transfer_buffer) {}
 };
 
 
@@ -401,7 +483,8 @@ struct Reader<T, typename enable_string_copy<T>::type>: public StringBuffer<T, B
   public:
     explicit Reader(const std::vector<size_t>& _dims,
                     const T& /* val */,
-                    const DataType& _file_datatype)
+                    const DataType& _file_datatype,
+                    TransferBuffer* /* transfer_buffer */ = nullptr)
         : StringBuffer<T, BufferMode::Write>(_dims, _file_datatype) {}
 };
 
@@ -409,16 +492,18 @@ struct data_converter {
     template <typename T>
     static Writer<T> serialize(const typename inspector<T>::type& val,
                                const std::vector<size_t>& dims,
-                               const DataType& file_datatype) {
-        return Writer<T>(val, dims, file_datatype);
+                               const DataType& file_datatype,
+                               TransferBuffer* transfer_buffer = nullptr) {
+        return Writer<T>(val, dims, file_datatype, transfer_buffer);
     }
 
     template <typename T>
     static Reader<T> get_reader(const std::vector<size_t>& dims,
                                 T& val,
-                                const DataType& file_datatype) {
+                                const DataType& file_datatype,
+                                TransferBuffer* transfer_buffer = nullptr) {
         inspector<T>::prepare(val, dims);
-        return Reader<T>(dims, val, file_datatype);
+        return Reader<T>(dims, val, file_datatype, transfer_buffer);
     }
 };
 
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <algorithm>
+#include <exception>
 #include <functional>
 #include <numeric>
 #include <sstream>
@@ -19,6 +20,10 @@
 #include "h5d_wrapper.hpp"
 #include "H5Utils.hpp"
 
+#include "../H5Appender.hpp"
+#include "../H5ChunkRange.hpp"
+#include "../H5MappedArray.hpp"
+
 namespace HighFive {
 
 inline uint64_t DataSet::getStorageSize() const {
@@ -47,6 +52,139 @@ inline uint64_t DataSet::getOffset() const {
     return static_cast<uint64_t>(detail::h5d_get_offset(_hid));
 }
 
+#if H5_VERSION_GE(1, 10, 2)
+inline void DataSet::writeChunk(const std::vector<size_t>& offset,
+                                const void* data,
+                                size_t n_bytes,
+                                uint32_t filter_mask,
+                                const DataTransferProps& xfer_props) {
+    auto chunk_offset = toHDF5SizeVector(offset);
+    detail::h5d_write_chunk(
+        _hid, xfer_props.getId(), filter_mask, chunk_offset.data(), n_bytes, data);
+}
+
+inline void DataSet::writeChunk(const std::vector<size_t>& offset,
+                                const std::vector<uint8_t>& data,
+                                uint32_t filter_mask,
+                                const DataTransferProps& xfer_props) {
+    writeChunk(offset, data.data(), data.size(), filter_mask, xfer_props);
+}
+
+inline uint64_t DataSet::getChunkStorageSize(const std::vector<size_t>& offset) const {
+    auto chunk_offset = toHDF5SizeVector(offset);
+    hsize_t n_bytes = 0;
+    detail::h5d_get_chunk_storage_size(_hid, chunk_offset.data(), &n_bytes);
+    return static_cast<uint64_t>(n_bytes);
+}
+
+inline uint32_t DataSet::readChunk(const std::vector<size_t>& offset,
+                                   void* buffer,
+                                   const DataTransferProps& xfer_props) const {
+    auto chunk_offset = toHDF5SizeVector(offset);
+    uint32_t filter_mask = 0;
+    detail::h5d_read_chunk(_hid, xfer_props.getId(), chunk_offset.data(), &filter_mask, buffer);
+    return filter_mask;
+}
+
+inline uint32_t DataSet::readChunk(const std::vector<size_t>& offset,
+                                   std::vector<uint8_t>& buffer,
+                                   const DataTransferProps& xfer_props) const {
+    buffer.resize(static_cast<size_t>(getChunkStorageSize(offset)));
+    return readChunk(offset, static_cast<void*>(buffer.data()), xfer_props);
+}
+#endif
+
+#if H5_VERSION_GE(1, 10, 5)
+inline size_t DataSet::getNumberChunks() const {
+    hsize_t n_chunks = 0;
+    detail::h5d_get_num_chunks(_hid, getSpace().getId(), &n_chunks);
+    return static_cast<size_t>(n_chunks);
+}
+
+inline ChunkInfo DataSet::getChunkInfoByIndex(size_t index) const {
+    auto file_space = getSpace();
+    auto offset = std::vector<hsize_t>(file_space.getNumberDimensions());
+    unsigned filter_mask = 0;
+    haddr_t address = HADDR_UNDEF;
+    hsize_t n_bytes = 0;
+    detail::h5d_get_chunk_info(
+        _hid, file_space.getId(), index, offset.data(), &filter_mask, &address, &n_bytes);
+
+    return ChunkInfo{toSTLSizeVector(offset),
+                     filter_mask,
+                     static_cast<uint64_t>(address),
+                     static_cast<uint64_t>(n_bytes)};
+}
+
+inline ChunkInfo DataSet::getChunkInfo(const std::vector<size_t>& offset) const {
+    auto chunk_offset = toHDF5SizeVector(offset);
+    unsigned filter_mask = 0;
+    haddr_t address = HADDR_UNDEF;
+    hsize_t n_bytes = 0;
+    detail::h5d_get_chunk_info_by_coord(
+        _hid, chunk_offset.data(), &filter_mask, &address, &n_bytes);
+
+    return ChunkInfo{offset,
+                     filter_mask,
+                     static_cast<uint64_t>(address),
+                     static_cast<uint64_t>(n_bytes)};
+}
+
+inline std::vector<ChunkInfo> DataSet::listChunks() const {
+    auto rank = getSpace().getNumberDimensions();
+    auto chunks = std::vector<ChunkInfo>{};
+
+#if H5_VERSION_GE(1, 14, 0)
+    struct IterationData {
+        size_t rank;
+        std::vector<ChunkInfo>& chunks;
+        std::exception_ptr error;
+    };
+
+    // Exceptions must not propagate through HDF5.
+    auto callback = [](const hsize_t* offset,
+                       unsigned filter_mask,
+                       haddr_t address,
+                       hsize_t n_bytes,
+                       void* op_data) -> int {
+        auto& data = *static_cast<IterationData*>(op_data);
+        try {
+            data.chunks.push_back(ChunkInfo{std::vector<size_t>(offset, offset + data.rank),
+                                            filter_mask,
+                                            static_cast<uint64_t>(address),
+                                            static_cast<uint64_t>(n_bytes)});
+            return H5_ITER_CONT;
+        } catch (...) {
+            data.error = std::current_exception();
+        }
+        return H5_ITER_ERROR;
+    };
+
+    auto data = IterationData{rank, chunks, nullptr};
+    try {
+        detail::h5d_chunk_iter(_hid, H5P_DEFAULT, callback, static_cast<void*>(&data));
+    } catch (const DataSetException&) {
+        if (data.error == nullptr) {
+            throw;
+        }
+    }
+
+    if (data.error != nullptr) {
+        std::rethrow_exception(data.error);
+    }
+#else
+    (void) rank;
+    auto n_chunks = getNumberChunks();
+    chunks.reserve(n_chunks);
+    for (size_t i = 0; i < n_chunks; ++i) {
+        chunks.push_back(getChunkInfoByIndex(i));
+    }
+#endif
+
+    return chunks;
+}
+#endif
+
 inline void DataSet::resize(const std::vector<size_t>& dims) {
     const size_t numDimensions = getSpace().getDimensions().size();
     if (dims.size() != numDimensions) {
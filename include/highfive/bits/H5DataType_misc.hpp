@@ -29,6 +29,12 @@ inline std::string type_class_string(DataTypeClass);
 inline hid_t create_string(std::size_t length);
 }  // namespace
 
+namespace detail {
+inline DataType make_data_type(hid_t hid) {
+    return DataType(hid);
+}
+}  // namespace detail
+
 inline bool DataType::empty() const noexcept {
     return _hid == H5I_INVALID_HID;
 }
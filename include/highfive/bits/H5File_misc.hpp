@@ -8,13 +8,17 @@
  */
 #pragma once
 
+#include <atomic>
 #include <string>
+#include <vector>
 
 #include <H5Fpublic.h>
 
+#include "../H5Instrumentation.hpp"
 #include "../H5Utility.hpp"
 #include "H5Utils.hpp"
 #include "h5f_wrapper.hpp"
+#include "h5p_wrapper.hpp"
 
 namespace HighFive {
 
@@ -70,6 +74,7 @@ inline File::File(const std::string& filename,
     // open is default. It's skipped only if flags require creation
     // If open fails it will try create() if H5F_ACC_CREAT is set
     if (!mustCreate) {
+        HIGHFIVE_INSTRUMENT(IOOperation::Open, filename)
         // Silence open errors if create is allowed
         std::unique_ptr<SilenceHDF5> silencer;
         if (openOrCreate) {
@@ -91,11 +96,133 @@ inline File::File(const std::string& filename,
         }
     }
 
+    HIGHFIVE_INSTRUMENT(IOOperation::Create, filename)
     auto fcpl = fileCreateProps.getId();
     auto fapl = fileAccessProps.getId();
     _hid = detail::h5f_create(filename.c_str(), createMode, fcpl, fapl);
 }
 
+namespace details {
+
+// A caller-owned file image that the core driver reads in place. The file
+// image callbacks hand out the caller's buffer instead of allocating and
+// copying; HDF5 keeps references to this struct in property lists and open
+// files, see `H5Pset_file_image_callbacks`.
+struct BorrowedFileImage {
+    void* data;
+    size_t size;
+    size_t ref_count;
+
+    static void* image_malloc(size_t n_bytes, H5FD_file_image_op_t /* op */, void* udata) {
+        auto* image = static_cast<BorrowedFileImage*>(udata);
+        return n_bytes <= image->size ? image->data : nullptr;
+    }
+
+    static void* image_memcpy(void* dest,
+                              const void* src,
+                              size_t /* size */,
+                              H5FD_file_image_op_t /* op */,
+                              void* /* udata */) {
+        // Both are the caller's buffer, as returned by `image_malloc`.
+        return dest == src ? dest : nullptr;
+    }
+
+    static void* image_realloc(void* /* ptr */,
+                               size_t /* size */,
+                               H5FD_file_image_op_t /* op */,
+                               void* /* udata */) {
+        // The image is read-only.
+        return nullptr;
+    }
+
+    static herr_t image_free(void* /* ptr */,
+                             H5FD_file_image_op_t /* op */,
+                             void* /* udata */) {
+        return 0;
+    }
+
+    static void* udata_copy(void* udata) {
+        ++static_cast<BorrowedFileImage*>(udata)->ref_count;
+        return udata;
+    }
+
+    static herr_t udata_free(void* udata) {
+        auto* image = static_cast<BorrowedFileImage*>(udata);
+        if (--image->ref_count == 0) {
+            delete image;
+        }
+        return 0;
+    }
+};
+
+// A name for a file in memory; the core driver identifies files by name.
+inline std::string unique_memory_file_name(const std::string& prefix) {
+    static std::atomic<size_t> counter{0};
+    return prefix + std::to_string(counter++);
+}
+
+}  // namespace details
+
+inline File File::fromImage(const void* data, size_t size, AccessMode access_mode) {
+    FileAccessProps fapl;
+    fapl.add(CoreDriver(1 << 20, false));
+
+    if (any(access_mode & (ReadWrite | WriteSWMR))) {
+        detail::h5p_set_file_image(fapl.getId(), const_cast<void*>(data), size);
+    } else {
+        auto* image = new details::BorrowedFileImage{const_cast<void*>(data), size, 1};
+        H5FD_file_image_callbacks_t callbacks{&details::BorrowedFileImage::image_malloc,
+                                              &details::BorrowedFileImage::image_memcpy,
+                                              &details::BorrowedFileImage::image_realloc,
+                                              &details::BorrowedFileImage::image_free,
+                                              &details::BorrowedFileImage::udata_copy,
+                                              &details::BorrowedFileImage::udata_free,
+                                              image};
+
+        // HDF5 takes its own references to `image`; ours is released here.
+        try {
+            detail::h5p_set_file_image_callbacks(fapl.getId(), &callbacks);
+            detail::h5p_set_file_image(fapl.getId(), const_cast<void*>(data), size);
+        } catch (...) {
+            details::BorrowedFileImage::udata_free(image);
+            throw;
+        }
+        details::BorrowedFileImage::udata_free(image);
+    }
+
+    return File(details::unique_memory_file_name("highfive_image_"), access_mode, fapl);
+}
+
+inline File File::createInMemory(const std::string& name, size_t increment) {
+    FileAccessProps fapl;
+    fapl.add(CoreDriver(increment, false));
+
+    auto filename = name.empty() ? details::unique_memory_file_name("highfive_memory_") : name;
+    return File(filename, Truncate, fapl);
+}
+
+inline size_t File::getImageSize() const {
+    // Metadata still cached by HDF5 isn't part of the image.
+    detail::h5f_flush(getId(), H5F_SCOPE_LOCAL);
+    return static_cast<size_t>(detail::h5f_get_file_image(getId(), nullptr, 0));
+}
+
+inline size_t File::getImage(void* buffer, size_t size) const {
+    auto image_size = getImageSize();
+    if (size < image_size) {
+        throw FileException("Unable to copy the image of '" + getName() + "' of " +
+                            std::to_string(image_size) + " bytes into a buffer of " +
+                            std::to_string(size) + " bytes.");
+    }
+    return static_cast<size_t>(detail::h5f_get_file_image(getId(), buffer, size));
+}
+
+inline std::vector<uint8_t> File::getImage() const {
+    auto image = std::vector<uint8_t>(getImageSize());
+    getImage(image.data(), image.size());
+    return image;
+}
+
 inline const std::string& File::getName() const {
     if (_filename.empty()) {
         _filename = details::get_name([this](char* buffer, size_t length) {
@@ -136,6 +263,7 @@ inline hsize_t File::getFileSpacePageSize() const {
 #endif
 
 inline void File::flush() {
+    HIGHFIVE_INSTRUMENT(IOOperation::Flush, getName())
     detail::h5f_flush(_hid, H5F_SCOPE_GLOBAL);
 }
 
@@ -155,4 +283,32 @@ inline size_t File::getFreeSpace() const {
     return static_cast<size_t>(detail::h5f_get_freespace(_hid));
 }
 
+inline void File::enableHandleCache(size_t capacity) {
+    _handle_cache = std::make_shared<details::HandleCache>(capacity);
+}
+
+inline void File::disableHandleCache() noexcept {
+    _handle_cache.reset();
+}
+
+inline void File::clearHandleCache() noexcept {
+    if (_handle_cache) {
+        _handle_cache->clear();
+    }
+}
+
+inline size_t File::getHandleCacheHits() const noexcept {
+    return _handle_cache ? _handle_cache->getHits() : 0;
+}
+
+inline size_t File::getHandleCacheMisses() const noexcept {
+    return _handle_cache ? _handle_cache->getMisses() : 0;
+}
+
+namespace details {
+inline HandleCache* HandleCacheAccess::get(const File& file) noexcept {
+    return file._handle_cache.get();
+}
+}  // namespace details
+
 }  // namespace HighFive
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
 #include "compute_total_size.hpp"
 
 namespace HighFive {
@@ -15,5 +19,74 @@ struct type_helper;
 template <typename T>
 struct inspector;
 
+///
+/// \brief A non-owning view of the dimensions passed to an `inspector`.
+///
+/// Nested inspectors pass the trailing dimensions to the inspector of their
+/// elements via `drop_front`, which doesn't allocate. Converts implicitly to
+/// `std::vector<size_t>`, for inspectors that take the dimensions as a vector.
+class dims_view {
+  public:
+    dims_view() = default;
+
+    dims_view(const std::vector<size_t>& dims) noexcept
+        : _data(dims.data())
+        , _size(dims.size()) {}
+
+    // The view would outlive the temporary, e.g. in
+    // `dims_view dims = dset.getDimensions();`.
+    dims_view(std::vector<size_t>&& dims) = delete;
+
+    dims_view(const size_t* data, size_t size) noexcept
+        : _data(data)
+        , _size(size) {}
+
+    const size_t* begin() const noexcept {
+        return _data;
+    }
+
+    const size_t* end() const noexcept {
+        return _data + _size;
+    }
+
+    const size_t* data() const noexcept {
+        return _data;
+    }
+
+    size_t size() const noexcept {
+        return _size;
+    }
+
+    bool empty() const noexcept {
+        return _size == 0;
+    }
+
+    size_t operator[](size_t i) const noexcept {
+        return _data[i];
+    }
+
+    /// \brief The dimensions without the first `n` axes.
+    dims_view drop_front(size_t n) const noexcept {
+        return n < _size ? dims_view(_data + n, _size - n) : dims_view(end(), 0);
+    }
+
+    operator std::vector<size_t>() const {
+        return std::vector<size_t>(begin(), end());
+    }
+
+  private:
+    const size_t* _data = nullptr;
+    size_t _size = 0;
+};
+
 }  // namespace details
+
+inline size_t compute_total_size(details::dims_view dims) {
+    size_t n_elements = 1;
+    for (auto d: dims) {
+        n_elements *= d;
+    }
+    return n_elements;
+}
+
 }  // namespace HighFive
@@ -61,22 +61,37 @@ inspector<T> {
     // array of `base_type[N]`?
     static constexpr bool is_trivially_nestable
 
+    // Optional: Is this type a strided view of `hdf5_type`, i.e. not
+    // trivially copyable but every element is at a fixed distance along each
+    // axis from `data(val)`?
+    // If this value is true: data() and getStrides() are mandatory
+    static constexpr bool is_strided
+
+    // The `dims` passed to prepare, serialize and unserialize are a
+    // non-owning `dims_view`; nested inspectors pass `dims.drop_front(ndim)`
+    // to the inspector of their elements, which doesn't allocate.
+
     // Reading:
-    // Allocate the value following dims (should be recursive)
-    static void prepare(type& val, const std::vector<std::size_t> dims)
+    // Allocate the value following dims (should be recursive). Elements
+    // needn't be initialized, since they're overwritten by the read, e.g.
+    // `std::vector<T, default_init_allocator<T>>` leaves them uninitialized.
+    static void prepare(type& val, dims_view dims)
     // Return a pointer of the first value of val (for reading)
     static hdf5_type* data(type& val)
     // Take a serialized vector 'in', some dims and copy value to val (for reading)
-    static void unserialize(const hdf5_type* in, const std::vector<size_t>&i, type& val)
+    static void unserialize(const hdf5_type* in, dims_view dims, type& val)
 
 
     // Writing:
     // Return a point of the first value of val
     static const hdf5_type* data(const type& val)
     // Take a val and serialize it inside 'out'
-    static void serialize(const type& val, const std::vector<size_t>& dims, hdf5_type* out)
+    static void serialize(const type& val, dims_view dims, hdf5_type* out)
     // Return an array of dimensions of the space needed for writing val
     static std::vector<size_t> getDimensions(const type& val)
+    // Return the distance, in number of `hdf5_type`, between neighbouring
+    // elements along each axis (only if `is_strided`)
+    static std::vector<size_t> getStrides(const type& val)
 }
 *****/
 
@@ -103,7 +118,7 @@ struct type_helper {
         return {};
     }
 
-    static void prepare(type& /* val */, const std::vector<size_t>& /* dims */) {}
+    static void prepare(type& /* val */, dims_view /* dims */) {}
 
     static hdf5_type* data(type& val) {
         static_assert(is_trivially_copyable, "The type is not trivially copyable");
@@ -115,14 +130,12 @@ struct type_helper {
         return &val;
     }
 
-    static void serialize(const type& val, const std::vector<size_t>& /* dims*/, hdf5_type* m) {
+    static void serialize(const type& val, dims_view /* dims */, hdf5_type* m) {
         static_assert(is_trivially_copyable, "The type is not trivially copyable");
         *m = val;
     }
 
-    static void unserialize(const hdf5_type* vec,
-                            const std::vector<size_t>& /* dims */,
-                            type& val) {
+    static void unserialize(const hdf5_type* vec, dims_view /* dims */, type& val) {
         static_assert(is_trivially_copyable, "The type is not trivially copyable");
         val = vec[0];
     }
@@ -152,13 +165,11 @@ struct inspector<bool>: type_helper<bool> {
         throw DataSpaceException("A boolean cannot be written directly.");
     }
 
-    static void unserialize(const hdf5_type* vec,
-                            const std::vector<size_t>& /* dims */,
-                            type& val) {
+    static void unserialize(const hdf5_type* vec, dims_view /* dims */, type& val) {
         val = vec[0] != 0;
     }
 
-    static void serialize(const type& val, const std::vector<size_t>& /* dims*/, hdf5_type* m) {
+    static void serialize(const type& val, dims_view /* dims */, hdf5_type* m) {
         *m = val ? 1 : 0;
     }
 };
@@ -176,12 +187,12 @@ struct inspector<std::string>: type_helper<std::string> {
     }
 
     template <class It>
-    static void serialize(const type& val, const std::vector<size_t>& /* dims*/, It m) {
+    static void serialize(const type& val, dims_view /* dims */, It m) {
         (*m).assign(val.data(), val.size(), StringPadding::NullTerminated);
     }
 
     template <class It>
-    static void unserialize(const It& vec, const std::vector<size_t>& /* dims */, type& val) {
+    static void unserialize(const It& vec, dims_view /* dims */, type& val) {
         const auto& view = *vec;
         val.assign(view.data(), view.length());
     }
@@ -202,22 +213,20 @@ struct inspector<Reference>: type_helper<Reference> {
         throw DataSpaceException("A Reference cannot be written directly.");
     }
 
-    static void serialize(const type& val, const std::vector<size_t>& /* dims*/, hdf5_type* m) {
+    static void serialize(const type& val, dims_view /* dims */, hdf5_type* m) {
         hobj_ref_t ref;
         val.create_ref(&ref);
         *m = ref;
     }
 
-    static void unserialize(const hdf5_type* vec,
-                            const std::vector<size_t>& /* dims */,
-                            type& val) {
+    static void unserialize(const hdf5_type* vec, dims_view /* dims */, type& val) {
         val = type{vec[0]};
     }
 };
 
-template <typename T>
-struct inspector<std::vector<T>> {
-    using type = std::vector<T>;
+template <typename T, typename Allocator>
+struct inspector<std::vector<T, Allocator>> {
+    using type = std::vector<T, Allocator>;
     using value_type = unqualified_t<T>;
     using base_type = typename inspector<value_type>::base_type;
     using hdf5_type = typename inspector<value_type>::hdf5_type;
@@ -251,9 +260,9 @@ struct inspector<std::vector<T>> {
         return sizes;
     }
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
+    static void prepare(type& val, dims_view dims) {
         val.resize(dims[0]);
-        std::vector<size_t> next_dims(dims.begin() + 1, dims.end());
+        auto next_dims = dims.drop_front(1);
         for (auto&& e: val) {
             inspector<value_type>::prepare(e, next_dims);
         }
@@ -268,9 +277,9 @@ struct inspector<std::vector<T>> {
     }
 
     template <class It>
-    static void serialize(const type& val, const std::vector<size_t>& dims, It m) {
+    static void serialize(const type& val, dims_view dims, It m) {
         if (!val.empty()) {
-            auto subdims = std::vector<size_t>(dims.begin() + 1, dims.end());
+            auto subdims = dims.drop_front(1);
             size_t subsize = compute_total_size(subdims);
             for (auto&& e: val) {
                 inspector<value_type>::serialize(e, subdims, m);
@@ -280,8 +289,8 @@ struct inspector<std::vector<T>> {
     }
 
     template <class It>
-    static void unserialize(const It& vec_align, const std::vector<size_t>& dims, type& val) {
-        std::vector<size_t> next_dims(dims.begin() + 1, dims.end());
+    static void unserialize(const It& vec_align, dims_view dims, type& val) {
+        auto next_dims = dims.drop_front(1);
         size_t next_size = compute_total_size(next_dims);
         for (size_t i = 0; i < dims[0]; ++i) {
             inspector<value_type>::unserialize(vec_align + i * next_size, next_dims, val[i]);
@@ -312,7 +321,7 @@ struct inspector<std::vector<bool>> {
         return sizes;
     }
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
+    static void prepare(type& val, dims_view dims) {
         if (dims.size() > 1) {
             throw DataSpaceException("std::vector<bool> is only 1 dimension.");
         }
@@ -327,15 +336,13 @@ struct inspector<std::vector<bool>> {
         throw DataSpaceException("A std::vector<bool> cannot be written directly.");
     }
 
-    static void serialize(const type& val, const std::vector<size_t>& /* dims*/, hdf5_type* m) {
+    static void serialize(const type& val, dims_view /* dims */, hdf5_type* m) {
         for (size_t i = 0; i < val.size(); ++i) {
             m[i] = val[i] ? 1 : 0;
         }
     }
 
-    static void unserialize(const hdf5_type* vec_align,
-                            const std::vector<size_t>& dims,
-                            type& val) {
+    static void unserialize(const hdf5_type* vec_align, dims_view dims, type& val) {
         for (size_t i = 0; i < dims[0]; ++i) {
             val[i] = vec_align[i] != 0;
         }
@@ -369,14 +376,14 @@ struct inspector<std::array<T, N>> {
         return sizes;
     }
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
+    static void prepare(type& val, dims_view dims) {
         if (dims[0] > N) {
             std::ostringstream os;
             os << "Size of std::array (" << N << ") is too small for dims (" << dims[0] << ").";
             throw DataSpaceException(os.str());
         }
 
-        std::vector<size_t> next_dims(dims.begin() + 1, dims.end());
+        auto next_dims = dims.drop_front(1);
         for (auto&& e: val) {
             inspector<value_type>::prepare(e, next_dims);
         }
@@ -391,8 +398,8 @@ struct inspector<std::array<T, N>> {
     }
 
     template <class It>
-    static void serialize(const type& val, const std::vector<size_t>& dims, It m) {
-        auto subdims = std::vector<size_t>(dims.begin() + 1, dims.end());
+    static void serialize(const type& val, dims_view dims, It m) {
+        auto subdims = dims.drop_front(1);
         size_t subsize = compute_total_size(subdims);
         for (auto& e: val) {
             inspector<value_type>::serialize(e, subdims, m);
@@ -401,14 +408,14 @@ struct inspector<std::array<T, N>> {
     }
 
     template <class It>
-    static void unserialize(const It& vec_align, const std::vector<size_t>& dims, type& val) {
+    static void unserialize(const It& vec_align, dims_view dims, type& val) {
         if (dims[0] != N) {
             std::ostringstream os;
             os << "Impossible to pair DataSet with " << dims[0] << " elements into an array with "
                << N << " elements.";
             throw DataSpaceException(os.str());
         }
-        std::vector<size_t> next_dims(dims.begin() + 1, dims.end());
+        auto next_dims = dims.drop_front(1);
         size_t next_size = compute_total_size(next_dims);
         for (size_t i = 0; i < val.size(); ++i) {
             inspector<value_type>::unserialize(vec_align + i * next_size, next_dims, val[i]);
@@ -451,9 +458,7 @@ struct inspector<T*> {
 
     /* it works because there is only T[][][] currently
        we will fix it one day */
-    static void serialize(const type& /* val */,
-                          const std::vector<size_t>& /* dims*/,
-                          hdf5_type* /* m */) {
+    static void serialize(const type& /* val */, dims_view /* dims */, hdf5_type* /* m */) {
         throw DataSpaceException("Not possible to serialize a T*");
     }
 };
@@ -474,7 +479,7 @@ struct inspector<T[N]> {
                                                   inspector<value_type>::is_trivially_nestable;
     static constexpr bool is_trivially_nestable = is_trivially_copyable;
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
+    static void prepare(type& val, dims_view dims) {
         if (dims.empty()) {
             throw DataSpaceException("Invalid 'dims', must be at least 1 dimensional.");
         }
@@ -483,7 +488,7 @@ struct inspector<T[N]> {
             throw DataSpaceException("Dimensions mismatch.");
         }
 
-        std::vector<size_t> next_dims(dims.begin() + 1, dims.end());
+        auto next_dims = dims.drop_front(1);
         for (size_t i = 0; i < N; ++i) {
             inspector<value_type>::prepare(val[i], next_dims);
         }
@@ -510,8 +515,8 @@ struct inspector<T[N]> {
 
     /* it works because there is only T[][][] currently
        we will fix it one day */
-    static void serialize(const type& val, const std::vector<size_t>& dims, hdf5_type* m) {
-        auto subdims = std::vector<size_t>(dims.begin() + 1, dims.end());
+    static void serialize(const type& val, dims_view dims, hdf5_type* m) {
+        auto subdims = dims.drop_front(1);
         size_t subsize = compute_total_size(subdims);
         for (size_t i = 0; i < N; ++i) {
             inspector<value_type>::serialize(val[i], subdims, m + i * subsize);
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <H5FDsec2.h>
+
+#include "compute_total_size.hpp"
+#include "h5f_wrapper.hpp"
+#include "h5p_wrapper.hpp"
+#include "posix_io.hpp"
+#include "../H5DataType.hpp"
+#include "../H5Exception.hpp"
+#include "../H5File.hpp"
+#include "../H5Utility.hpp"
+
+namespace HighFive {
+
+template <class T>
+inline MappedArray<T>::MappedArray(void* mapping,
+                                   size_t mapping_size,
+                                   const T* data,
+                                   std::vector<size_t> dims)
+    : _mapping(mapping)
+    , _mapping_size(mapping_size)
+    , _data(data)
+    , _size(compute_total_size(dims))
+    , _dims(std::move(dims)) {}
+
+template <class T>
+inline MappedArray<T>::MappedArray(MappedArray&& other) noexcept
+    : _mapping(other._mapping)
+    , _mapping_size(other._mapping_size)
+    , _data(other._data)
+    , _size(other._size)
+    , _dims(std::move(other._dims)) {
+    other._mapping = nullptr;
+    other._data = nullptr;
+    other._size = 0;
+}
+
+template <class T>
+inline MappedArray<T>& MappedArray<T>::operator=(MappedArray&& other) noexcept {
+    if (this != &other) {
+        release();
+        _mapping = other._mapping;
+        _mapping_size = other._mapping_size;
+        _data = other._data;
+        _size = other._size;
+        _dims = std::move(other._dims);
+
+        other._mapping = nullptr;
+        other._data = nullptr;
+        other._size = 0;
+    }
+    return *this;
+}
+
+template <class T>
+inline MappedArray<T>::~MappedArray() {
+    release();
+}
+
+template <class T>
+template <class... Index>
+inline const T& MappedArray<T>::operator()(Index... index) const noexcept {
+    const std::array<size_t, sizeof...(Index)> indices{{static_cast<size_t>(index)...}};
+
+    size_t linear_index = 0;
+    for (size_t k = 0; k < indices.size(); ++k) {
+        linear_index = linear_index * _dims[k] + indices[k];
+    }
+    return _data[linear_index];
+}
+
+template <class T>
+inline void MappedArray<T>::release() noexcept {
+    if (_mapping != nullptr) {
+        HIGHFIVE_LOG_ERROR_IF(!details::unmap_file_range(_mapping, _mapping_size),
+                              std::string("Failed to unmap a dataset: ") + std::strerror(errno));
+        _mapping = nullptr;
+    }
+}
+
+template <class T>
+inline MappedArray<T> DataSet::map() const {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only datasets of trivially copyable types can be mapped.");
+
+    auto fail = [this](const std::string& reason) {
+        throw DataSetException("Unable to map '" + getPath() + "': " + reason + ".");
+    };
+
+    auto create_props = getCreatePropertyList();
+    if (detail::h5p_get_layout(create_props.getId()) != H5D_CONTIGUOUS) {
+        fail("the dataset isn't contiguous");
+    }
+    if (detail::h5p_get_nfilters(create_props.getId()) != 0) {
+        fail("the dataset is filtered");
+    }
+    if (detail::h5p_get_external_count(create_props.getId()) != 0) {
+        fail("the dataset is stored in external files");
+    }
+    if (!(getDataType() == create_datatype<T>())) {
+        fail("its datatype differs from the datatype in memory, e.g. in size or byte order");
+    }
+
+    const auto& file = getFile();
+    if (detail::h5p_get_driver(file.getAccessPropertyList().getId()) != H5FD_SEC2) {
+        fail("only files using the default driver can be mapped");
+    }
+
+    auto dims = getDimensions();
+    auto n_bytes = compute_total_size(dims) * sizeof(T);
+    if (n_bytes == 0) {
+        return MappedArray<T>(nullptr, 0, nullptr, std::move(dims));
+    }
+    if (getStorageSize() < n_bytes) {
+        fail("its storage hasn't been allocated");
+    }
+
+    auto offset = getOffset();
+    if (offset % alignof(T) != 0) {
+        fail("its data isn't aligned in the file, see `H5Pset_alignment`");
+    }
+
+    // Data still cached by HDF5 must reach the file first.
+    detail::h5f_flush(getId(), H5F_SCOPE_LOCAL);
+
+    auto mapping = details::map_file_range(file.getName(), offset, n_bytes);
+    return MappedArray<T>(mapping.address,
+                          mapping.size,
+                          static_cast<const T*>(mapping.data),
+                          std::move(dims));
+}
+
+}  // namespace HighFive
@@ -0,0 +1,336 @@
+#pragma once
+
+#include <exception>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "H5Converter_misc.hpp"
+#include "H5ReadWrite_misc.hpp"
+#include "H5Slice_traits_misc.hpp"
+#include "H5Utils.hpp"
+#include "h5d_wrapper.hpp"
+#include "h5o_wrapper.hpp"
+#include "h5t_wrapper.hpp"
+#include "../H5Exception.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+template <class T>
+class PendingWrite: public PendingTransfer {
+  public:
+    PendingWrite(const DataSet& dataset_,
+                 const DataType& mem_datatype_,
+                 const DataSpace& file_space_,
+                 const DataSpace& mem_space_,
+                 const T& buffer,
+                 const DataType& file_datatype)
+        : PendingTransfer(IOOperation::Write, dataset_, mem_datatype_, file_space_, mem_space_)
+        , _writer(data_converter::serialize<T>(buffer, mem_space_.getDimensions(), file_datatype)) {
+        n_staged_bytes = _writer.getStagedBytes();
+    }
+
+    void* getPointer() override {
+        // HDF5 only reads from this buffer.
+        return const_cast<void*>(static_cast<const void*>(_writer.getPointer()));
+    }
+
+  private:
+    Writer<T> _writer;
+};
+
+template <class T>
+class PendingRead: public PendingTransfer {
+  public:
+    PendingRead(const DataSet& dataset_,
+                const DataType& mem_datatype_,
+                const DataSpace& file_space_,
+                const DataSpace& mem_space_,
+                T& array,
+                const DataType& file_datatype)
+        : PendingTransfer(IOOperation::Read, dataset_, mem_datatype_, file_space_, mem_space_)
+        , _array(array)
+        , _reader(data_converter::get_reader<T>(mem_space_.getDimensions(), array, file_datatype)) {
+        n_staged_bytes = _reader.getStagedBytes();
+    }
+
+    void* getPointer() override {
+        return static_cast<void*>(_reader.getPointer());
+    }
+
+    void finish(const DataTransferProps& xfer_props) override {
+        try {
+            _reader.unserialize(_array);
+        } catch (...) {
+            reclaim(xfer_props);
+            throw;
+        }
+        reclaim(xfer_props);
+    }
+
+  private:
+    void reclaim(const DataTransferProps& xfer_props) {
+        if (mem_datatype.getClass() == DataTypeClass::VarLen || mem_datatype.isVariableStr()) {
+#if H5_VERSION_GE(1, 12, 0)
+            (void) detail::h5t_reclaim(mem_datatype.getId(),
+                                       mem_space.getId(),
+                                       xfer_props.getId(),
+                                       _reader.getPointer());
+#else
+            (void) detail::h5d_vlen_reclaim(mem_datatype.getId(),
+                                            mem_space.getId(),
+                                            xfer_props.getId(),
+                                            _reader.getPointer());
+#endif
+        }
+    }
+
+    T& _array;
+    Reader<T> _reader;
+};
+
+// The memory space of `slice`; for a whole dataset it's the file space.
+inline DataSpace get_memspace(const DataSet& /* dataset */, const DataSpace& file_space) {
+    return file_space;
+}
+
+inline DataSpace get_memspace(const Selection& selection, const DataSpace& /* file_space */) {
+    return selection.getMemSpace();
+}
+
+}  // namespace details
+
+inline MultiTransfer::MultiTransfer(const DataTransferProps& xfer_props)
+    : _xfer_props(xfer_props) {}
+
+template <class T>
+inline void MultiTransfer::write(const DataSet& dataset, const T& buffer) {
+    queueWrite(dataset, buffer);
+}
+
+template <class T>
+inline void MultiTransfer::write(const Selection& selection, const T& buffer) {
+    queueWrite(selection, buffer);
+}
+
+template <class T>
+inline void MultiTransfer::read(const DataSet& dataset, T& array) {
+    queueRead(dataset, array);
+}
+
+template <class T>
+inline void MultiTransfer::read(const Selection& selection, T& array) {
+    queueRead(selection, array);
+}
+
+template <class Slice, class T>
+inline void MultiTransfer::queueWrite(const Slice& slice, const T& buffer) {
+    const auto& dataset = details::get_dataset(slice);
+    auto file_space = slice.getSpace();
+    auto mem_space = details::get_memspace(slice, file_space);
+    auto file_datatype = slice.getDataType();
+
+    const details::BufferInfo<T> buffer_info(
+        file_datatype,
+        [&dataset]() -> std::string { return dataset.getPath(); },
+        details::BufferInfo<T>::Operation::write);
+
+    if (!details::checkDimensions(mem_space, buffer_info.getMinRank(), buffer_info.getMaxRank())) {
+        std::ostringstream ss;
+        ss << "Impossible to write buffer with dimensions n = " << buffer_info.getRank(buffer)
+           << " into dataset with dimensions " << details::format_vector(mem_space.getDimensions())
+           << ".";
+        throw DataSpaceException(ss.str());
+    }
+
+    auto pending = std::unique_ptr<details::PendingWrite<T>>(new details::PendingWrite<T>(
+        dataset, buffer_info.data_type, file_space, mem_space, buffer, file_datatype));
+#if HIGHFIVE_INSTRUMENTATION
+    pending->n_bytes = mem_space.getElementCount() * buffer_info.data_type.getSize();
+    pending->is_converted = !(buffer_info.data_type == file_datatype);
+#endif
+    _queue.push_back(std::move(pending));
+}
+
+template <class Slice, class T>
+inline void MultiTransfer::queueRead(const Slice& slice, T& array) {
+    static_assert(!std::is_const<T>::value,
+                  "read() requires a non-const structure to read data into");
+
+    const auto& dataset = details::get_dataset(slice);
+    auto file_space = slice.getSpace();
+    auto mem_space = details::get_memspace(slice, file_space);
+    auto file_datatype = slice.getDataType();
+
+    const details::BufferInfo<T> buffer_info(
+        file_datatype,
+        [&dataset]() -> std::string { return dataset.getPath(); },
+        details::BufferInfo<T>::Operation::read);
+
+    if (!details::checkDimensions(mem_space, buffer_info.getMinRank(), buffer_info.getMaxRank())) {
+        std::ostringstream ss;
+        ss << "Impossible to read DataSet of dimensions " << mem_space.getNumberDimensions()
+           << " into arrays of dimensions: " << buffer_info.getMinRank() << "(min) to "
+           << buffer_info.getMaxRank() << "(max)";
+        throw DataSpaceException(ss.str());
+    }
+
+    auto pending = std::unique_ptr<details::PendingRead<T>>(new details::PendingRead<T>(
+        dataset, buffer_info.data_type, file_space, mem_space, array, file_datatype));
+#if HIGHFIVE_INSTRUMENTATION
+    pending->n_bytes = mem_space.getElementCount() * buffer_info.data_type.getSize();
+    pending->is_converted = !(buffer_info.data_type == file_datatype);
+#endif
+    _queue.push_back(std::move(pending));
+}
+
+inline void MultiTransfer::execute() {
+    auto queue = std::move(_queue);
+    _queue.clear();
+
+    // Each batch is finished before the next is issued; hence, if one throws,
+    // the reads before it are complete.
+    size_t begin = 0;
+    while (begin < queue.size()) {
+        auto end = findBatchEnd(queue, begin);
+        transferBatch(queue, begin, end);
+        finishBatch(queue, begin, end);
+        begin = end;
+    }
+}
+
+inline size_t MultiTransfer::findBatchEnd(const queue_type& queue, size_t begin) {
+#if H5_VERSION_GE(1, 14, 0)
+    // `H5Dwrite_multi` and `H5Dread_multi` only accept datasets of a single
+    // file, each listed at most once.
+    unsigned long fileno = 0;
+    auto tokens = std::set<std::string>{};
+    size_t end = begin;
+    for (; end < queue.size(); ++end) {
+        if (queue[end]->operation != queue[begin]->operation) {
+            break;
+        }
+
+        H5O_info2_t info;
+        detail::h5o_get_info3(queue[end]->dataset.getId(), &info, H5O_INFO_BASIC);
+        auto token = std::string(reinterpret_cast<const char*>(&info.token), sizeof(info.token));
+        if (end > begin && (info.fileno != fileno || tokens.count(token) != 0)) {
+            break;
+        }
+        fileno = info.fileno;
+        tokens.insert(std::move(token));
+    }
+    return end;
+#else
+    (void) queue;
+    return begin + 1;
+#endif
+}
+
+inline void MultiTransfer::transferBatch(queue_type& queue, size_t begin, size_t end) const {
+    auto operation = queue[begin]->operation;
+    bool is_write = operation == IOOperation::Write;
+
+#if H5_VERSION_GE(1, 14, 0)
+    if (end - begin > 1) {
+        auto count = end - begin;
+        auto dset_ids = std::vector<hid_t>(count);
+        auto mem_type_ids = std::vector<hid_t>(count);
+        auto mem_space_ids = std::vector<hid_t>(count);
+        auto file_space_ids = std::vector<hid_t>(count);
+        auto buffers = std::vector<void*>(count);
+        for (size_t i = 0; i < count; ++i) {
+            const auto& pending = queue[begin + i];
+            dset_ids[i] = pending->dataset.getId();
+            mem_type_ids[i] = pending->mem_datatype.getId();
+            mem_space_ids[i] = pending->mem_space.getId();
+            file_space_ids[i] = pending->file_space.getId();
+            buffers[i] = pending->getPointer();
+        }
+
+#if HIGHFIVE_INSTRUMENTATION
+        // Every dataset is recorded with the duration of the whole batch.
+        auto scopes = std::vector<std::unique_ptr<detail::IOScope>>{};
+        for (size_t i = begin; i < end; ++i) {
+            const auto& pending = queue[i];
+            scopes.emplace_back(new detail::IOScope(operation,
+                                                    pending->dataset.getPath(),
+                                                    pending->n_bytes,
+                                                    pending->n_staged_bytes,
+                                                    pending->is_converted));
+        }
+#endif
+
+        if (is_write) {
+            auto const_buffers = std::vector<const void*>(buffers.begin(), buffers.end());
+            detail::h5d_write_multi(count,
+                                    dset_ids.data(),
+                                    mem_type_ids.data(),
+                                    mem_space_ids.data(),
+                                    file_space_ids.data(),
+                                    _xfer_props.getId(),
+                                    const_buffers.data());
+        } else {
+            detail::h5d_read_multi(count,
+                                   dset_ids.data(),
+                                   mem_type_ids.data(),
+                                   mem_space_ids.data(),
+                                   file_space_ids.data(),
+                                   _xfer_props.getId(),
+                                   buffers.data());
+        }
+        return;
+    }
+#endif
+
+    for (size_t i = begin; i < end; ++i) {
+        auto& pending = queue[i];
+        HIGHFIVE_INSTRUMENT(operation,
+                            pending->dataset.getPath(),
+                            pending->n_bytes,
+                            pending->n_staged_bytes,
+                            pending->is_converted)
+
+        if (is_write) {
+            detail::h5d_write(pending->dataset.getId(),
+                              pending->mem_datatype.getId(),
+                              pending->mem_space.getId(),
+                              pending->file_space.getId(),
+                              _xfer_props.getId(),
+                              pending->getPointer());
+        } else {
+            detail::h5d_read(pending->dataset.getId(),
+                             pending->mem_datatype.getId(),
+                             pending->mem_space.getId(),
+                             pending->file_space.getId(),
+                             _xfer_props.getId(),
+                             pending->getPointer());
+        }
+    }
+}
+
+inline void MultiTransfer::finishBatch(queue_type& queue, size_t begin, size_t end) const {
+    // Even if one throws, all others are finished, and their memory reclaimed.
+    std::exception_ptr error = nullptr;
+    for (size_t i = begin; i < end; ++i) {
+        try {
+            queue[i]->finish(_xfer_props);
+        } catch (...) {
+            if (error == nullptr) {
+                error = std::current_exception();
+            }
+        }
+    }
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace HighFive
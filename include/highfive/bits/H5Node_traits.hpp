@@ -217,6 +217,10 @@ class NodeTraits {
     // It makes behavior consistent among versions and by default transforms
     // errors to exceptions
     bool _exist(const std::string& node_path, bool raise_errors = true) const;
+
+    // Drops `node_path` from the handle cache, if there is one; see
+    // `File::enableHandleCache`.
+    void _invalidate(const std::string& node_path) const;
 };
 
 
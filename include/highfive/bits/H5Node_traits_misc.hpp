@@ -18,12 +18,14 @@
 
 #include "../H5DataSet.hpp"
 #include "../H5Group.hpp"
+#include "../H5Instrumentation.hpp"
 #include "../H5Selection.hpp"
 #include "../H5Utility.hpp"
 #include "H5DataSet_misc.hpp"
 #include "H5Iterables_misc.hpp"
 #include "H5Selection_misc.hpp"
 #include "H5Slice_traits_misc.hpp"
+#include "handle_cache.hpp"
 
 #include "h5l_wrapper.hpp"
 #include "h5g_wrapper.hpp"
@@ -40,6 +42,9 @@ inline DataSet NodeTraits<Derivate>::createDataSet(const std::string& dataset_na
                                                    const DataSetCreateProps& createProps,
                                                    const DataSetAccessProps& accessProps,
                                                    bool parents) {
+    HIGHFIVE_INSTRUMENT(IOOperation::Create,
+                        detail::io_path(static_cast<Derivate*>(this)->getPath(), dataset_name))
+    _invalidate(dataset_name);
     LinkCreateProps lcpl;
     lcpl.add(CreateIntermediateGroup(parents));
     return DataSet(detail::h5d_create2(static_cast<Derivate*>(this)->getId(),
@@ -58,8 +63,12 @@ inline DataSet NodeTraits<Derivate>::createDataSet(const std::string& dataset_na
                                                    const DataSetCreateProps& createProps,
                                                    const DataSetAccessProps& accessProps,
                                                    bool parents) {
-    return createDataSet(
-        dataset_name, space, create_and_check_datatype<T>(), createProps, accessProps, parents);
+    return createDataSet(dataset_name,
+                         space,
+                         details::DataTypeCache::getChecked<T>(),
+                         createProps,
+                         accessProps,
+                         parents);
 }
 
 template <typename Derivate>
@@ -69,13 +78,13 @@ inline DataSet NodeTraits<Derivate>::createDataSet(const std::string& dataset_na
                                                    const DataSetCreateProps& createProps,
                                                    const DataSetAccessProps& accessProps,
                                                    bool parents) {
-    DataSet ds =
-        createDataSet(dataset_name,
-                      DataSpace::From(data),
-                      create_and_check_datatype<typename details::inspector<T>::base_type>(),
-                      createProps,
-                      accessProps,
-                      parents);
+    using base_type = typename details::inspector<T>::base_type;
+    DataSet ds = createDataSet(dataset_name,
+                               DataSpace::From(data),
+                               details::DataTypeCache::getChecked<base_type>(),
+                               createProps,
+                               accessProps,
+                               parents);
     ds.write(data);
     return ds;
 }
@@ -83,13 +92,33 @@ inline DataSet NodeTraits<Derivate>::createDataSet(const std::string& dataset_na
 template <typename Derivate>
 inline DataSet NodeTraits<Derivate>::getDataSet(const std::string& dataset_name,
                                                 const DataSetAccessProps& accessProps) const {
-    return DataSet(detail::h5d_open2(static_cast<const Derivate*>(this)->getId(),
-                                     dataset_name.c_str(),
-                                     accessProps.getId()));
+    HIGHFIVE_INSTRUMENT(
+        IOOperation::Open,
+        detail::io_path(static_cast<const Derivate*>(this)->getPath(), dataset_name))
+    auto cache = details::HandleCacheAccess::get(static_cast<const Derivate&>(*this));
+    if (cache == nullptr || accessProps.getId() != H5P_DEFAULT) {
+        return DataSet(detail::h5d_open2(static_cast<const Derivate*>(this)->getId(),
+                                         dataset_name.c_str(),
+                                         accessProps.getId()));
+    }
+
+    auto hid = cache->find(dataset_name, ObjectType::Dataset);
+    if (hid != H5I_INVALID_HID) {
+        return DataSet(hid);
+    }
+
+    auto dataset = DataSet(detail::h5d_open2(static_cast<const Derivate*>(this)->getId(),
+                                             dataset_name.c_str(),
+                                             H5P_DEFAULT));
+    cache->insert(dataset_name, ObjectType::Dataset, dataset.getId());
+    return dataset;
 }
 
 template <typename Derivate>
 inline Group NodeTraits<Derivate>::createGroup(const std::string& group_name, bool parents) {
+    HIGHFIVE_INSTRUMENT(IOOperation::Create,
+                        detail::io_path(static_cast<Derivate*>(this)->getPath(), group_name))
+    _invalidate(group_name);
     LinkCreateProps lcpl;
     lcpl.add(CreateIntermediateGroup(parents));
     return detail::make_group(detail::h5g_create2(static_cast<Derivate*>(this)->getId(),
@@ -103,6 +132,9 @@ template <typename Derivate>
 inline Group NodeTraits<Derivate>::createGroup(const std::string& group_name,
                                                const GroupCreateProps& createProps,
                                                bool parents) {
+    HIGHFIVE_INSTRUMENT(IOOperation::Create,
+                        detail::io_path(static_cast<Derivate*>(this)->getPath(), group_name))
+    _invalidate(group_name);
     LinkCreateProps lcpl;
     lcpl.add(CreateIntermediateGroup(parents));
     return detail::make_group(detail::h5g_create2(static_cast<Derivate*>(this)->getId(),
@@ -114,9 +146,25 @@ inline Group NodeTraits<Derivate>::createGroup(const std::string& group_name,
 
 template <typename Derivate>
 inline Group NodeTraits<Derivate>::getGroup(const std::string& group_name) const {
-    return detail::make_group(detail::h5g_open2(static_cast<const Derivate*>(this)->getId(),
-                                                group_name.c_str(),
-                                                H5P_DEFAULT));
+    HIGHFIVE_INSTRUMENT(IOOperation::Open,
+                        detail::io_path(static_cast<const Derivate*>(this)->getPath(), group_name))
+    auto cache = details::HandleCacheAccess::get(static_cast<const Derivate&>(*this));
+    if (cache == nullptr) {
+        return detail::make_group(detail::h5g_open2(static_cast<const Derivate*>(this)->getId(),
+                                                    group_name.c_str(),
+                                                    H5P_DEFAULT));
+    }
+
+    auto hid = cache->find(group_name, ObjectType::Group);
+    if (hid != H5I_INVALID_HID) {
+        return detail::make_group(hid);
+    }
+
+    auto group = detail::make_group(detail::h5g_open2(static_cast<const Derivate*>(this)->getId(),
+                                                      group_name.c_str(),
+                                                      H5P_DEFAULT));
+    cache->insert(group_name, ObjectType::Group, group.getId());
+    return group;
 }
 
 template <typename Derivate>
@@ -152,6 +200,7 @@ template <typename Derivate>
 inline bool NodeTraits<Derivate>::rename(const std::string& src_path,
                                          const std::string& dst_path,
                                          bool parents) const {
+    _invalidate("/");
     LinkCreateProps lcpl;
     lcpl.add(CreateIntermediateGroup(parents));
     herr_t err = detail::h5l_move(static_cast<const Derivate*>(this)->getId(),
@@ -201,8 +250,22 @@ inline bool NodeTraits<Derivate>::_exist(const std::string& node_path, bool rais
     return (node_path == "/") ? true : (val > 0);
 }
 
+template <typename Derivate>
+inline void NodeTraits<Derivate>::_invalidate(const std::string& node_path) const {
+    auto cache = details::HandleCacheAccess::get(static_cast<const Derivate&>(*this));
+    if (cache != nullptr) {
+        cache->invalidate(node_path);
+    }
+}
+
 template <typename Derivate>
 inline bool NodeTraits<Derivate>::exist(const std::string& node_path) const {
+    ObjectType object_type;
+    auto cache = details::HandleCacheAccess::get(static_cast<const Derivate&>(*this));
+    if (cache != nullptr && cache->findType(node_path, object_type)) {
+        return true;
+    }
+
     // When there are slashes, first check everything is fine
     // so that subsequent errors are only due to missing intermediate groups
     if (node_path.find('/') != std::string::npos) {
@@ -216,6 +279,7 @@ inline bool NodeTraits<Derivate>::exist(const std::string& node_path) const {
 
 template <typename Derivate>
 inline void NodeTraits<Derivate>::unlink(const std::string& node_path) const {
+    _invalidate("/");
     detail::h5l_delete(static_cast<const Derivate*>(this)->getId(), node_path.c_str(), H5P_DEFAULT);
 }
 
@@ -254,10 +318,16 @@ inline LinkType NodeTraits<Derivate>::getLinkType(const std::string& node_path)
 
 template <typename Derivate>
 inline ObjectType NodeTraits<Derivate>::getObjectType(const std::string& node_path) const {
+    ObjectType object_type;
+    auto cache = details::HandleCacheAccess::get(static_cast<const Derivate&>(*this));
+    if (cache != nullptr && cache->findType(node_path, object_type)) {
+        return object_type;
+    }
+
     const auto id = detail::h5o_open(static_cast<const Derivate*>(this)->getId(),
                                      node_path.c_str(),
                                      H5P_DEFAULT);
-    auto object_type = _convert_object_type(detail::h5i_get_type(id));
+    object_type = _convert_object_type(detail::h5i_get_type(id));
     detail::h5o_close(id);
     return object_type;
 }
@@ -272,6 +342,7 @@ inline void NodeTraits<Derivate>::createSoftLink(const std::string& link_name,
     if (parents) {
         linkCreateProps.add(CreateIntermediateGroup{});
     }
+    _invalidate(link_name);
     detail::h5l_create_soft(obj_path.c_str(),
                             static_cast<const Derivate*>(this)->getId(),
                             link_name.c_str(),
@@ -290,6 +361,7 @@ inline void NodeTraits<Derivate>::createExternalLink(const std::string& link_nam
     if (parents) {
         linkCreateProps.add(CreateIntermediateGroup{});
     }
+    _invalidate(link_name);
     detail::h5l_create_external(h5_file.c_str(),
                                 obj_path.c_str(),
                                 static_cast<const Derivate*>(this)->getId(),
@@ -310,6 +382,7 @@ inline void NodeTraits<Derivate>::createHardLink(const std::string& link_name,
     if (parents) {
         linkCreateProps.add(CreateIntermediateGroup{});
     }
+    _invalidate(link_name);
     detail::h5l_create_hard(target_obj.getId(),
                             ".",
                             static_cast<const Derivate*>(this)->getId(),
@@ -254,6 +254,28 @@ inline hsize_t MetadataBlockSize::getSize() const {
     return _size;
 }
 
+inline CoreDriver::CoreDriver(size_t increment, bool backing_store)
+    : _increment(increment)
+    , _backing_store(backing_store) {}
+
+inline CoreDriver::CoreDriver(const FileAccessProps& fapl) {
+    hbool_t backing_store = 0;
+    detail::h5p_get_fapl_core(fapl.getId(), &_increment, &backing_store);
+    _backing_store = backing_store > 0;
+}
+
+inline void CoreDriver::apply(const hid_t list) const {
+    detail::h5p_set_fapl_core(list, _increment, _backing_store);
+}
+
+inline size_t CoreDriver::getIncrement() const {
+    return _increment;
+}
+
+inline bool CoreDriver::hasBackingStore() const {
+    return _backing_store;
+}
+
 inline void EstimatedLinkInfo::apply(const hid_t hid) const {
     detail::h5p_set_est_link_info(hid, _entries, _length);
 }
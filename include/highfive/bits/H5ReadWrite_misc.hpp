@@ -11,6 +11,7 @@
 #include <H5Tpublic.h>
 #include "H5Inspector_misc.hpp"
 #include "H5Utils.hpp"
+#include "datatype_cache.hpp"
 
 namespace HighFive {
 
@@ -140,7 +141,7 @@ BufferInfo<T>::BufferInfo(const DataType& file_data_type, F getName, Operation _
     : op(_op)
     , is_fixed_len_string(file_data_type.isFixedLenStr())
     // In case we are using Fixed-len strings we need to subtract one dimension
-    , data_type(string_type_checker<char_array_t>::getDataType(create_datatype<elem_type>(),
+    , data_type(string_type_checker<char_array_t>::getDataType(DataTypeCache::get<elem_type>(),
                                                                file_data_type))
     , rank_correction((is_fixed_len_string && is_char_array) ? 1 : 0) {
     // We warn. In case they are really not convertible an exception will rise on read/write
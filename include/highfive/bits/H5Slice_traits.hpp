@@ -16,6 +16,8 @@
 #include "convert_size_vector.hpp"
 
 #include "../H5PropertyList.hpp"
+#include "../H5StringTable.hpp"
+#include "../H5TransferBuffer.hpp"
 #include "h5s_wrapper.hpp"
 
 namespace HighFive {
@@ -50,6 +52,8 @@ class ElementSet {
 
     template <typename Derivate>
     friend class SliceTraits;
+    template <class T>
+    friend class GatherReader;
 };
 
 inline std::vector<hsize_t> toHDF5SizeVector(const std::vector<size_t>& from) {
@@ -306,9 +310,11 @@ class HyperSlab: public HyperSlabInterface<HyperSlab> {
         }
 
         Select_ const* mid = begin + distance / 2;
-        auto right_space = reduce_streak(outer_space, begin, mid, op);
-        auto left_space = reduce_streak(outer_space, mid, end, op);
+        auto left_space = reduce_streak(outer_space, begin, mid, op);
+        auto right_space = reduce_streak(outer_space, mid, end, op);
 
+        // The order matters: HDF5 1.10 (at least) silently drops blocks of a
+        // strided left operand, if the right operand precedes it.
         return combine_selections(left_space, op, right_space);
     }
 
@@ -497,6 +503,19 @@ class SliceTraits {
     template <typename T>
     void read(T& array, const DataTransferProps& xfer_props = DataTransferProps()) const;
 
+    ///
+    /// Read the entire dataset into a buffer, reusing `transfer_buffer`.
+    ///
+    /// Same as `read(T&, const DataTransferProps&)`. However, if `array`
+    /// needs to be staged in an intermediate buffer, the memory of
+    /// `transfer_buffer` is used, avoiding an allocation per call.
+    ///
+    /// \since 3.4
+    template <typename T>
+    void read(T& array,
+              TransferBuffer& transfer_buffer,
+              const DataTransferProps& xfer_props = DataTransferProps()) const;
+
     ///
     /// Read the entire dataset into a raw buffer
     ///
@@ -523,6 +542,17 @@ class SliceTraits {
     template <typename T>
     void read_raw(T* array, const DataTransferProps& xfer_props = DataTransferProps()) const;
 
+    ///
+    /// \brief Read a string dataset into a `StringTable`.
+    ///
+    /// Works for fixed-length and variable-length strings. Variable-length
+    /// strings are allocated by HDF5 from an arena, see
+    /// `H5Pset_vlen_mem_manager`, instead of one `malloc` per string; any
+    /// memory manager set in `xfer_props` is ignored.
+    ///
+    /// \since 3.4
+    void read(StringTable& table, const DataTransferProps& xfer_props = DataTransferProps()) const;
+
 
     ///
     /// Write the integrality N-dimension buffer to this dataset
@@ -534,6 +564,19 @@ class SliceTraits {
     template <typename T>
     void write(const T& buffer, const DataTransferProps& xfer_props = DataTransferProps());
 
+    ///
+    /// Write the integrality N-dimension buffer, reusing `transfer_buffer`.
+    ///
+    /// Same as `write(const T&, const DataTransferProps&)`. However, if
+    /// `buffer` needs to be staged in an intermediate buffer, the memory of
+    /// `transfer_buffer` is used, avoiding an allocation per call.
+    ///
+    /// \since 3.4
+    template <typename T>
+    void write(const T& buffer,
+               TransferBuffer& transfer_buffer,
+               const DataTransferProps& xfer_props = DataTransferProps());
+
     ///
     /// Write from a raw pointer into this dataset.
     ///
@@ -10,17 +10,25 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <functional>
 #include <numeric>
 #include <sstream>
 #include <string>
 
 #include "h5d_wrapper.hpp"
+#include "h5p_wrapper.hpp"
 #include "h5s_wrapper.hpp"
 
+#include "../H5Instrumentation.hpp"
+
 #include "H5ReadWrite_misc.hpp"
 #include "H5Converter_misc.hpp"
+#include "conversion_kernels.hpp"
 #include "squeeze.hpp"
+#include "selection_compiler.hpp"
+#include "strided_transfer.hpp"
+#include "string_arena.hpp"
 #include "compute_total_size.hpp"
 #include "assert_compatible_spaces.hpp"
 
@@ -67,71 +75,76 @@ inline ElementSet::ElementSet(const std::vector<std::vector<std::size_t>>& eleme
 }
 
 namespace detail {
-class HyperCube {
-  public:
-    explicit HyperCube(size_t rank)
-        : offset(rank)
-        , count(rank) {}
-
-    void cross(const std::array<size_t, 2>& range, size_t axis) {
-        offset[axis] = range[0];
-        count[axis] = range[1] - range[0];
-    }
+inline void add_to_axis(AxisSelection& axis, const std::array<size_t, 2>& slice) {
+    axis.add(slice[0], slice[1]);
+}
 
-    RegularHyperSlab asSlab() {
-        return RegularHyperSlab(offset, count);
+inline void add_to_axis(AxisSelection& axis, const std::vector<std::array<size_t, 2>>& slices) {
+    for (const auto& slice: slices) {
+        axis.add(slice[0], slice[1]);
     }
+}
 
-  private:
-    std::vector<size_t> offset;
-    std::vector<size_t> count;
-};
-
-inline void build_hyper_slab(HyperSlab& slab, size_t /* axis */, HyperCube& cube) {
-    slab |= cube.asSlab();
+inline void add_to_axis(AxisSelection& axis, const std::vector<size_t>& ids) {
+    for (const auto& id: ids) {
+        axis.add(id);
+    }
 }
 
-template <class... Slices>
-inline void build_hyper_slab(HyperSlab& slab,
-                             size_t axis,
-                             HyperCube& cube,
-                             const std::array<size_t, 2>& slice,
-                             const Slices&... higher_slices) {
-    cube.cross(slice, axis);
-    build_hyper_slab(slab, axis + 1, cube, higher_slices...);
+inline void add_to_axis(AxisSelection& axis, size_t id) {
+    axis.add(id);
 }
 
-template <class... Slices>
-inline void build_hyper_slab(HyperSlab& slab,
-                             size_t axis,
-                             HyperCube& cube,
-                             const std::vector<std::array<size_t, 2>>& slices,
-                             const Slices&... higher_slices) {
-    for (const auto& slice: slices) {
-        build_hyper_slab(slab, axis, cube, slice, higher_slices...);
-    }
+inline void compile_axes(std::vector<std::vector<StridedBlocks>>& /* axes */) {}
+
+template <class Slice, class... Slices>
+inline void compile_axes(std::vector<std::vector<StridedBlocks>>& axes,
+                         const Slice& slice,
+                         const Slices&... higher_slices) {
+    AxisSelection axis;
+    add_to_axis(axis, slice);
+    axes.push_back(axis.compile());
+    compile_axes(axes, higher_slices...);
 }
 
-template <class... Slices>
-inline void build_hyper_slab(HyperSlab& slab,
-                             size_t axis,
-                             HyperCube& cube,
-                             const std::vector<size_t>& ids,
-                             const Slices&... higher_slices) {
-    for (const auto& id: ids) {
-        auto slice = std::array<size_t, 2>{id, id + 1};
-        build_hyper_slab(slab, axis, cube, slice, higher_slices...);
+// Selects the Cartesian product of the strided blocks along every axis, with
+// one `RegularHyperSlab` per combination.
+inline void build_hyper_slab(HyperSlab& slab, const std::vector<std::vector<StridedBlocks>>& axes) {
+    auto rank = axes.size();
+    for (const auto& axis: axes) {
+        if (axis.empty()) {
+            return;
+        }
     }
-}
 
-template <class... Slices>
-inline void build_hyper_slab(HyperSlab& slab,
-                             size_t axis,
-                             HyperCube& cube,
-                             size_t id,
-                             const Slices&... higher_slices) {
-    auto slice = std::array<size_t, 2>{id, id + 1};
-    build_hyper_slab(slab, axis, cube, slice, higher_slices...);
+    auto offset = std::vector<hsize_t>(rank);
+    auto count = std::vector<hsize_t>(rank);
+    auto stride = std::vector<hsize_t>(rank);
+    auto block = std::vector<hsize_t>(rank);
+    auto index = std::vector<size_t>(rank, 0);
+
+    while (true) {
+        for (size_t k = 0; k < rank; ++k) {
+            const auto& blocks = axes[k][index[k]];
+            offset[k] = blocks.offset;
+            count[k] = blocks.count;
+            stride[k] = blocks.stride;
+            block[k] = blocks.block;
+        }
+        slab |= RegularHyperSlab::fromHDF5Sizes(offset, count, stride, block);
+
+        size_t k = rank;
+        for (; k > 0; --k) {
+            if (++index[k - 1] < axes[k - 1].size()) {
+                break;
+            }
+            index[k - 1] = 0;
+        }
+
+        if (k == 0) {
+            return;
+        }
+    }
 }
 
 inline void compute_squashed_shape(size_t /* axis */, std::vector<size_t>& /* shape */) {
@@ -205,8 +218,9 @@ inline void compute_squashed_shape(size_t axis,
 template <class... Slices>
 inline ProductSet::ProductSet(const Slices&... slices) {
     auto rank = sizeof...(slices);
-    detail::HyperCube cube(rank);
-    detail::build_hyper_slab(slab, 0, cube, slices...);
+    auto axes = std::vector<std::vector<detail::StridedBlocks>>{};
+    detail::compile_axes(axes, slices...);
+    detail::build_hyper_slab(slab, axes);
 
     shape = std::vector<size_t>(rank, size_t(0));
     detail::compute_squashed_shape(0, shape, slices...);
@@ -223,6 +237,7 @@ inline Selection SliceTraits<Derivate>::select(const HyperSlab& hyper_slab,
     //       hyperslabs when the memory is not contiguous, e.g.
     //       `std::vector<std::vector<double>>`.
     const auto& slice = static_cast<const Derivate&>(*this);
+    HIGHFIVE_INSTRUMENT(IOOperation::Select, details::get_dataset(slice).getPath())
     auto filespace = hyper_slab.apply(slice.getSpace());
 
     return detail::make_selection(memspace, filespace, details::get_dataset(slice));
@@ -232,6 +247,7 @@ template <typename Derivate>
 template <typename Impl>
 inline Selection SliceTraits<Derivate>::select(const HyperSlabInterface<Impl>& hyper_slab) const {
     const auto& slice = static_cast<const Derivate&>(*this);
+    HIGHFIVE_INSTRUMENT(IOOperation::Select, details::get_dataset(slice).getPath())
     auto filespace = slice.getSpace();
     filespace = hyper_slab.apply(filespace);
 
@@ -263,15 +279,23 @@ inline Selection SliceTraits<Derivate>::select(const std::vector<size_t>& column
             "selecting columns; must be atleast 1-dimensional.");
     }
 
-    std::vector<size_t> counts = dims;
-    counts.back() = 1;
+    // All rows of runs of, or regularly spaced, columns are selected by a
+    // single hyperslab.
+    detail::AxisSelection axis;
+    detail::add_to_axis(axis, columns);
 
-    std::vector<size_t> offsets(dims.size(), 0);
+    auto offsets = std::vector<hsize_t>(dims.size(), 0);
+    auto counts = std::vector<hsize_t>(dims.size(), 1);
+    auto strides = std::vector<hsize_t>(dims.size(), 1);
+    auto blocks = toHDF5SizeVector(dims);
 
     HyperSlab slab;
-    for (const auto& column: columns) {
-        offsets.back() = column;
-        slab |= RegularHyperSlab(offsets, counts);
+    for (const auto& group: axis.compile()) {
+        offsets.back() = group.offset;
+        counts.back() = group.count;
+        strides.back() = group.stride;
+        blocks.back() = group.block;
+        slab |= RegularHyperSlab::fromHDF5Sizes(offsets, counts, strides, blocks);
     }
 
     std::vector<size_t> memdims = dims;
@@ -283,6 +307,7 @@ inline Selection SliceTraits<Derivate>::select(const std::vector<size_t>& column
 template <typename Derivate>
 inline Selection SliceTraits<Derivate>::select(const ElementSet& elements) const {
     const auto& slice = static_cast<const Derivate&>(*this);
+    HIGHFIVE_INSTRUMENT(IOOperation::Select, details::get_dataset(slice).getPath())
     const hsize_t* data = nullptr;
     const DataSpace space = slice.getSpace().clone();
     const std::size_t length = elements._ids.size();
@@ -328,6 +353,16 @@ inline T SliceTraits<Derivate>::read(const DataTransferProps& xfer_props) const
 template <typename Derivate>
 template <typename T>
 inline void SliceTraits<Derivate>::read(T& array, const DataTransferProps& xfer_props) const {
+    TransferBuffer transfer_buffer;
+    read(array, transfer_buffer, xfer_props);
+}
+
+
+template <typename Derivate>
+template <typename T>
+inline void SliceTraits<Derivate>::read(T& array,
+                                        TransferBuffer& transfer_buffer,
+                                        const DataTransferProps& xfer_props) const {
     const auto& slice = static_cast<const Derivate&>(*this);
     const DataSpace& mem_space = slice.getMemSpace();
 
@@ -347,10 +382,57 @@ inline void SliceTraits<Derivate>::read(T& array, const DataTransferProps& xfer_
     }
     auto dims = mem_space.getDimensions();
 
-    auto r = details::data_converter::get_reader<T>(dims, array, file_datatype);
-    read_raw(r.getPointer(), buffer_info.data_type, xfer_props);
-    // re-arrange results
-    r.unserialize(array);
+#if HIGHFIVE_INSTRUMENTATION
+    const auto n_staged = transfer_buffer.getStagedBytes();
+#endif
+    HIGHFIVE_INSTRUMENT(IOOperation::Read,
+                        details::get_dataset(slice).getPath(),
+                        mem_space.getElementCount() * buffer_info.data_type.getSize(),
+                        0,
+                        !(buffer_info.data_type == file_datatype))
+
+    if (details::read_strided(details::get_dataset(slice).getId(),
+                              slice.getSpace(),
+                              dims,
+                              array,
+                              buffer_info.data_type,
+                              xfer_props,
+                              transfer_buffer)) {
+        HIGHFIVE_INSTRUMENT_STAGED(transfer_buffer.getStagedBytes() - n_staged)
+        return;
+    }
+
+    auto r = details::data_converter::get_reader<T>(dims, array, file_datatype, &transfer_buffer);
+#if HIGHFIVE_CONVERSION_KERNELS
+    // Not `read_raw`, which would record a second event. Unless `r` uses
+    // it, `transfer_buffer` can stage the values to be converted.
+    auto n_converted = details::read_converting(details::get_dataset(slice).getId(),
+                                                buffer_info.data_type,
+                                                file_datatype,
+                                                details::get_memspace_id(slice),
+                                                slice.getSpace().getId(),
+                                                mem_space.getElementCount(),
+                                                xfer_props.getId(),
+                                                static_cast<void*>(r.getPointer()),
+                                                r.getStagedBytes() == 0 ? &transfer_buffer
+                                                                        : nullptr);
+    HIGHFIVE_INSTRUMENT_STAGED(r.getStagedBytes() + n_converted)
+    (void) n_converted;
+#else
+    HIGHFIVE_INSTRUMENT_STAGED(r.getStagedBytes())
+    // Not `read_raw`, which would record a second event.
+    detail::h5d_read(details::get_dataset(slice).getId(),
+                     buffer_info.data_type.getId(),
+                     details::get_memspace_id(slice),
+                     slice.getSpace().getId(),
+                     xfer_props.getId(),
+                     static_cast<void*>(r.getPointer()));
+#endif
+    {
+        HIGHFIVE_INSTRUMENT_SPAN(IOOperation::Unserialize, details::get_dataset(slice).getPath())
+        // re-arrange results
+        r.unserialize(array);
+    }
 
     auto t = buffer_info.data_type;
     auto c = t.getClass();
@@ -379,6 +461,11 @@ inline void SliceTraits<Derivate>::read_raw(T* array,
                   "read() requires a non-const structure to read data into");
 
     const auto& slice = static_cast<const Derivate&>(*this);
+    HIGHFIVE_INSTRUMENT(IOOperation::Read,
+                        details::get_dataset(slice).getPath(),
+                        slice.getMemSpace().getElementCount() * mem_datatype.getSize(),
+                        0,
+                        !(mem_datatype == slice.getDataType()))
 
     detail::h5d_read(details::get_dataset(slice).getId(),
                      mem_datatype.getId(),
@@ -393,15 +480,115 @@ template <typename Derivate>
 template <typename T>
 inline void SliceTraits<Derivate>::read_raw(T* array, const DataTransferProps& xfer_props) const {
     using element_type = typename details::inspector<T>::base_type;
-    const DataType& mem_datatype = create_and_check_datatype<element_type>();
+    const DataType mem_datatype = details::DataTypeCache::getChecked<element_type>();
 
     read_raw(array, mem_datatype, xfer_props);
 }
 
+template <typename Derivate>
+inline void SliceTraits<Derivate>::read(StringTable& table,
+                                        const DataTransferProps& xfer_props) const {
+    const auto& slice = static_cast<const Derivate&>(*this);
+    const auto& dataset = details::get_dataset(slice);
+
+    auto file_datatype = slice.getDataType();
+    if (file_datatype.getClass() != DataTypeClass::String) {
+        throw DataTypeException("Unable to read '" + dataset.getPath() +
+                                "' into a StringTable: its datatype '" + file_datatype.string() +
+                                "' isn't a string.");
+    }
+
+    auto string_datatype = file_datatype.asStringType();
+    auto dims = slice.getMemSpace().getDimensions();
+    auto n_strings = compute_total_size(dims);
+
+    auto& chars = table._chars;
+    auto& offsets = table._offsets;
+    offsets.resize(n_strings + 1);
+    offsets[0] = 0;
+
+    if (string_datatype.isVariableStr()) {
+        // HDF5 allocates the strings from `arena`, which frees them all at
+        // once; hence, there's nothing to reclaim.
+        details::StringArena arena(16 * n_strings);
+        auto arena_props = xfer_props.getId() == H5P_DEFAULT
+                               ? DataTransferProps::Empty()
+                               : details::get_plist<DataTransferProps>(xfer_props, H5Pcopy);
+        detail::h5p_set_vlen_mem_manager(arena_props.getId(),
+                                         &details::StringArena::allocate,
+                                         &arena,
+                                         &details::StringArena::deallocate,
+                                         nullptr);
+
+        auto pointers = std::vector<char*>(n_strings, nullptr);
+        auto mem_datatype = VariableLengthStringType(string_datatype.getCharacterSet());
+        HIGHFIVE_INSTRUMENT(IOOperation::Read,
+                            dataset.getPath(),
+                            n_strings * mem_datatype.getSize(),
+                            n_strings * sizeof(char*),
+                            !(mem_datatype == file_datatype))
+        detail::h5d_read(dataset.getId(),
+                         mem_datatype.getId(),
+                         details::get_memspace_id(slice),
+                         slice.getSpace().getId(),
+                         arena_props.getId(),
+                         static_cast<void*>(pointers.data()));
+
+        // Unwritten strings are null pointers, which are read as "".
+        for (size_t i = 0; i < n_strings; ++i) {
+            auto length = pointers[i] == nullptr ? 0 : std::strlen(pointers[i]);
+            offsets[i + 1] = offsets[i] + length + 1;
+        }
+
+        chars.resize(offsets[n_strings]);
+        for (size_t i = 0; i < n_strings; ++i) {
+            auto length = offsets[i + 1] - offsets[i] - 1;
+            if (length != 0) {
+                std::memcpy(chars.data() + offsets[i], pointers[i], length);
+            }
+            chars[offsets[i + 1] - 1] = '\0';
+        }
+    } else {
+        // Same as reading into `std::string`: null-terminated strings end at
+        // the first `'\0'`, padded strings keep their padding.
+        auto string_size = string_datatype.getSize();
+        auto is_null_terminated = string_datatype.getPadding() == StringPadding::NullTerminated;
+
+        auto buffer = std::vector<char>(n_strings * string_size);
+        read_raw(buffer.data(), string_datatype, xfer_props);
+
+        for (size_t i = 0; i < n_strings; ++i) {
+            const auto* str = buffer.data() + i * string_size;
+            auto length = is_null_terminated ? details::char_buffer_length(str, string_size)
+                                             : string_size;
+            offsets[i + 1] = offsets[i] + length + 1;
+        }
+
+        chars.resize(offsets[n_strings]);
+        for (size_t i = 0; i < n_strings; ++i) {
+            auto length = offsets[i + 1] - offsets[i] - 1;
+            std::memcpy(chars.data() + offsets[i], buffer.data() + i * string_size, length);
+            chars[offsets[i + 1] - 1] = '\0';
+        }
+    }
+
+    table._dims = std::move(dims);
+}
+
 
 template <typename Derivate>
 template <typename T>
 inline void SliceTraits<Derivate>::write(const T& buffer, const DataTransferProps& xfer_props) {
+    TransferBuffer transfer_buffer;
+    write(buffer, transfer_buffer, xfer_props);
+}
+
+
+template <typename Derivate>
+template <typename T>
+inline void SliceTraits<Derivate>::write(const T& buffer,
+                                         TransferBuffer& transfer_buffer,
+                                         const DataTransferProps& xfer_props) {
     const auto& slice = static_cast<const Derivate&>(*this);
     const DataSpace& mem_space = slice.getMemSpace();
     auto dims = mem_space.getDimensions();
@@ -420,8 +607,55 @@ inline void SliceTraits<Derivate>::write(const T& buffer, const DataTransferProp
            << ".";
         throw DataSpaceException(ss.str());
     }
-    auto w = details::data_converter::serialize<T>(buffer, dims, file_datatype);
-    write_raw(w.getPointer(), buffer_info.data_type, xfer_props);
+
+#if HIGHFIVE_INSTRUMENTATION
+    const auto n_staged = transfer_buffer.getStagedBytes();
+#endif
+    HIGHFIVE_INSTRUMENT(IOOperation::Write,
+                        details::get_dataset(slice).getPath(),
+                        mem_space.getElementCount() * buffer_info.data_type.getSize(),
+                        0,
+                        !(buffer_info.data_type == file_datatype))
+
+    if (details::write_strided(details::get_dataset(slice).getId(),
+                               slice.getSpace(),
+                               dims,
+                               buffer,
+                               buffer_info.data_type,
+                               xfer_props,
+                               transfer_buffer)) {
+        HIGHFIVE_INSTRUMENT_STAGED(transfer_buffer.getStagedBytes() - n_staged)
+        return;
+    }
+
+    auto w = [&]() {
+        HIGHFIVE_INSTRUMENT_SPAN(IOOperation::Serialize, details::get_dataset(slice).getPath())
+        return details::data_converter::serialize<T>(buffer, dims, file_datatype, &transfer_buffer);
+    }();
+#if HIGHFIVE_CONVERSION_KERNELS
+    // Not `write_raw`, which would record a second event.
+    auto n_converted = details::write_converting(details::get_dataset(slice).getId(),
+                                                 buffer_info.data_type,
+                                                 file_datatype,
+                                                 details::get_memspace_id(slice),
+                                                 slice.getSpace().getId(),
+                                                 mem_space.getElementCount(),
+                                                 xfer_props.getId(),
+                                                 static_cast<const void*>(w.getPointer()),
+                                                 w.getStagedBytes() == 0 ? &transfer_buffer
+                                                                         : nullptr);
+    HIGHFIVE_INSTRUMENT_STAGED(w.getStagedBytes() + n_converted)
+    (void) n_converted;
+#else
+    HIGHFIVE_INSTRUMENT_STAGED(w.getStagedBytes())
+    // Not `write_raw`, which would record a second event.
+    detail::h5d_write(details::get_dataset(slice).getId(),
+                      buffer_info.data_type.getId(),
+                      details::get_memspace_id(slice),
+                      slice.getSpace().getId(),
+                      xfer_props.getId(),
+                      static_cast<const void*>(w.getPointer()));
+#endif
 }
 
 
@@ -431,6 +665,11 @@ inline void SliceTraits<Derivate>::write_raw(const T* buffer,
                                              const DataType& mem_datatype,
                                              const DataTransferProps& xfer_props) {
     const auto& slice = static_cast<const Derivate&>(*this);
+    HIGHFIVE_INSTRUMENT(IOOperation::Write,
+                        details::get_dataset(slice).getPath(),
+                        slice.getMemSpace().getElementCount() * mem_datatype.getSize(),
+                        0,
+                        !(mem_datatype == slice.getDataType()))
 
     detail::h5d_write(details::get_dataset(slice).getId(),
                       mem_datatype.getId(),
@@ -445,7 +684,7 @@ template <typename Derivate>
 template <typename T>
 inline void SliceTraits<Derivate>::write_raw(const T* buffer, const DataTransferProps& xfer_props) {
     using element_type = typename details::inspector<T>::base_type;
-    const auto& mem_datatype = create_and_check_datatype<element_type>();
+    const auto mem_datatype = details::DataTypeCache::getChecked<element_type>();
 
     write_raw(buffer, mem_datatype, xfer_props);
 }
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <functional>
+#include <future>
+#include <utility>
+
+namespace HighFive {
+
+namespace details {
+
+// Buffers passed to `writeAsync` are owned by the request, unless they're
+// wrapped in an `std::reference_wrapper`.
+template <class T>
+struct async_buffer {
+    static const T& get(const T& buffer) {
+        return buffer;
+    }
+};
+
+template <class T>
+struct async_buffer<std::reference_wrapper<T>> {
+    static const T& get(const std::reference_wrapper<T>& buffer) {
+        return buffer.get();
+    }
+};
+
+// Copying an HDF5 object increments its reference count, which mustn't race
+// with the I/O thread.
+template <class T>
+T async_copy(const T& obj) {
+    auto hdf5_lock = AsyncIOQueue::lock();
+    return obj;
+}
+
+}  // namespace details
+
+template <typename T, typename Derivate>
+inline std::future<T> readAsync(const SliceTraits<Derivate>& slice,
+                                const DataTransferProps& xfer_props) {
+    auto copy = details::async_copy(static_cast<const Derivate&>(slice));
+    auto props = details::async_copy(xfer_props);
+
+    return AsyncIOQueue::getDefault().submit(
+        [copy = std::move(copy), props = std::move(props)]() {
+            return copy.template read<T>(props);
+        });
+}
+
+template <typename Derivate, typename T>
+inline std::future<void> readAsync(const SliceTraits<Derivate>& slice,
+                                   T& array,
+                                   const DataTransferProps& xfer_props) {
+    auto copy = details::async_copy(static_cast<const Derivate&>(slice));
+    auto props = details::async_copy(xfer_props);
+
+    return AsyncIOQueue::getDefault().submit(
+        [copy = std::move(copy), props = std::move(props), &array]() {
+            copy.read(array, props);
+        });
+}
+
+template <typename Derivate, typename T>
+inline std::future<void> writeAsync(const SliceTraits<Derivate>& slice,
+                                    T buffer,
+                                    const DataTransferProps& xfer_props) {
+    auto copy = details::async_copy(static_cast<const Derivate&>(slice));
+    auto props = details::async_copy(xfer_props);
+
+    return AsyncIOQueue::getDefault().submit(
+        [copy = std::move(copy), props = std::move(props), buffer = std::move(buffer)]() mutable {
+            copy.write(details::async_buffer<T>::get(buffer), props);
+        });
+}
+
+template <typename T>
+inline std::future<T> readAsync(const Attribute& attr) {
+    auto copy = details::async_copy(attr);
+
+    return AsyncIOQueue::getDefault().submit(
+        [copy = std::move(copy)]() { return copy.template read<T>(); });
+}
+
+template <typename T>
+inline std::future<void> readAsync(const Attribute& attr, T& array) {
+    auto copy = details::async_copy(attr);
+
+    return AsyncIOQueue::getDefault().submit(
+        [copy = std::move(copy), &array]() { copy.read(array); });
+}
+
+template <typename T>
+inline std::future<void> writeAsync(const Attribute& attr, T value) {
+    auto copy = details::async_copy(attr);
+
+    return AsyncIOQueue::getDefault().submit(
+        [copy = std::move(copy), value = std::move(value)]() mutable {
+            copy.write(details::async_buffer<T>::get(value));
+        });
+}
+
+}  // namespace HighFive
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <H5Zpublic.h>
+#include <zlib.h>
+
+#include "h5p_wrapper.hpp"
+#include "../H5Exception.hpp"
+#include "../H5PropertyList.hpp"
+
+namespace HighFive {
+namespace details {
+
+///
+/// \brief Byte transposition, identical to HDF5's `H5Z_FILTER_SHUFFLE`.
+///
+/// Byte `j` of element `i` is moved to position `j * n_elements + i`. Trailing
+/// bytes that don't form a whole element are copied as they are.
+inline void shuffle_bytes(const uint8_t* src, uint8_t* dst, size_t n_bytes, size_t element_size) {
+    auto n_elements = element_size > 1 ? n_bytes / element_size : size_t(0);
+    if (n_elements <= 1) {
+        std::copy(src, src + n_bytes, dst);
+        return;
+    }
+
+    for (size_t j = 0; j < element_size; ++j) {
+        auto* dst_j = dst + j * n_elements;
+        for (size_t i = 0; i < n_elements; ++i) {
+            dst_j[i] = src[i * element_size + j];
+        }
+    }
+
+    auto n_shuffled = n_elements * element_size;
+    std::copy(src + n_shuffled, src + n_bytes, dst + n_shuffled);
+}
+
+///
+/// \brief Inverse of `shuffle_bytes`.
+inline void unshuffle_bytes(const uint8_t* src, uint8_t* dst, size_t n_bytes, size_t element_size) {
+    auto n_elements = element_size > 1 ? n_bytes / element_size : size_t(0);
+    if (n_elements <= 1) {
+        std::copy(src, src + n_bytes, dst);
+        return;
+    }
+
+    for (size_t j = 0; j < element_size; ++j) {
+        const auto* src_j = src + j * n_elements;
+        for (size_t i = 0; i < n_elements; ++i) {
+            dst[i * element_size + j] = src_j[i];
+        }
+    }
+
+    auto n_shuffled = n_elements * element_size;
+    std::copy(src + n_shuffled, src + n_bytes, dst + n_shuffled);
+}
+
+///
+/// \brief Compress `src` into `dst`, identical to HDF5's `H5Z_FILTER_DEFLATE`.
+inline void deflate_bytes(const std::vector<uint8_t>& src,
+                          std::vector<uint8_t>& dst,
+                          unsigned level) {
+    auto n_bytes = compressBound(static_cast<uLong>(src.size()));
+    dst.resize(n_bytes);
+
+    int status = compress2(dst.data(),
+                           &n_bytes,
+                           src.data(),
+                           static_cast<uLong>(src.size()),
+                           static_cast<int>(level));
+    if (status != Z_OK) {
+        throw DataSetException("Failed to deflate chunk, zlib error " + std::to_string(status) +
+                               ".");
+    }
+
+    dst.resize(n_bytes);
+}
+
+///
+/// \brief Decompress `src` into `dst`, which is expected to need `n_bytes`.
+///
+/// If the decompressed data is larger than `n_bytes`, `dst` is grown as needed.
+inline void inflate_bytes(const std::vector<uint8_t>& src,
+                          std::vector<uint8_t>& dst,
+                          size_t n_bytes) {
+    z_stream stream = {};
+    stream.next_in = const_cast<Bytef*>(src.data());
+    stream.avail_in = static_cast<uInt>(src.size());
+
+    if (inflateInit(&stream) != Z_OK) {
+        throw DataSetException("Failed to initialize zlib.");
+    }
+
+    dst.resize(std::max(n_bytes, size_t(1)));
+    int status = Z_OK;
+    while (true) {
+        stream.next_out = dst.data() + stream.total_out;
+        stream.avail_out = static_cast<uInt>(dst.size() - stream.total_out);
+
+        status = inflate(&stream, Z_NO_FLUSH);
+        if (status == Z_STREAM_END) {
+            break;
+        }
+
+        if (status != Z_OK || (stream.avail_out != 0 && stream.avail_in == 0)) {
+            inflateEnd(&stream);
+            throw DataSetException("Failed to inflate chunk, zlib error " +
+                                   std::to_string(status) + ".");
+        }
+
+        if (stream.avail_out == 0) {
+            dst.resize(2 * dst.size());
+        }
+    }
+
+    dst.resize(stream.total_out);
+    inflateEnd(&stream);
+}
+
+///
+/// \brief The filters of a chunked dataset, applied outside of HDF5.
+///
+/// Only shuffle and deflate are supported; for any other filter the
+/// constructor throws a `DataSetException`. The filters are applied in the
+/// same order as HDF5 would apply them, which produces the same bytes as
+/// `H5Dwrite`; `decode` reverts them like `H5Dread` does.
+class ChunkFilterPipeline {
+  public:
+    ChunkFilterPipeline(const DataSetCreateProps& create_props,
+                        size_t element_size,
+                        const std::string& path)
+        : _element_size(element_size) {
+        auto n_filters = detail::h5p_get_nfilters(create_props.getId());
+        for (int i = 0; i < n_filters; ++i) {
+            unsigned flags = 0;
+            unsigned config = 0;
+            unsigned cd_values[8] = {};
+            size_t cd_nelmts = 8;
+            char name[64] = {};
+
+            auto id = detail::h5p_get_filter2(create_props.getId(),
+                                              static_cast<unsigned>(i),
+                                              &flags,
+                                              &cd_nelmts,
+                                              cd_values,
+                                              sizeof(name),
+                                              name,
+                                              &config);
+
+            if (id != H5Z_FILTER_SHUFFLE && id != H5Z_FILTER_DEFLATE) {
+                throw DataSetException("Unable to filter the chunks of '" + path +
+                                       "' outside of HDF5: unsupported filter '" +
+                                       std::string(name) + "'.");
+            }
+
+            cd_nelmts = std::min(cd_nelmts, size_t(8));
+            _filters.push_back({id, std::vector<unsigned>(cd_values, cd_values + cd_nelmts)});
+        }
+    }
+
+    ///
+    /// \brief Apply all filters to `chunk`, in place.
+    ///
+    /// The `scratch` space is used for intermediate results and can be reused
+    /// for the next chunk.
+    void encode(std::vector<uint8_t>& chunk, std::vector<uint8_t>& scratch) const {
+        for (const auto& filter: _filters) {
+            if (filter.id == H5Z_FILTER_SHUFFLE) {
+                auto element_size = filter.cd_values.empty() ? _element_size
+                                                             : size_t(filter.cd_values[0]);
+                scratch.resize(chunk.size());
+                shuffle_bytes(chunk.data(), scratch.data(), chunk.size(), element_size);
+            } else {
+                auto level = filter.cd_values.empty() ? 6u : filter.cd_values[0];
+                deflate_bytes(chunk, scratch, level);
+            }
+
+            chunk.swap(scratch);
+        }
+    }
+
+    ///
+    /// \brief Revert all filters of `chunk`, in place.
+    ///
+    /// Filters whose bit is set in `filter_mask` weren't applied to this chunk
+    /// and are skipped. `n_bytes` is the size of the unfiltered chunk.
+    void decode(std::vector<uint8_t>& chunk,
+                uint32_t filter_mask,
+                size_t n_bytes,
+                std::vector<uint8_t>& scratch) const {
+        for (size_t k = _filters.size(); k > 0; --k) {
+            const auto& filter = _filters[k - 1];
+            if (filter_mask & (uint32_t(1) << (k - 1))) {
+                continue;
+            }
+
+            if (filter.id == H5Z_FILTER_SHUFFLE) {
+                auto element_size = filter.cd_values.empty() ? _element_size
+                                                             : size_t(filter.cd_values[0]);
+                scratch.resize(chunk.size());
+                unshuffle_bytes(chunk.data(), scratch.data(), chunk.size(), element_size);
+            } else {
+                inflate_bytes(chunk, scratch, n_bytes);
+            }
+
+            chunk.swap(scratch);
+        }
+
+        if (chunk.size() != n_bytes) {
+            throw DataSetException("Unfiltered chunk has " + std::to_string(chunk.size()) +
+                                   " bytes, expected " + std::to_string(n_bytes) + ".");
+        }
+    }
+
+  private:
+    struct Filter {
+        H5Z_filter_t id;
+        std::vector<unsigned> cd_values;
+    };
+
+    std::vector<Filter> _filters;
+    size_t _element_size;
+};
+
+}  // namespace details
+}  // namespace HighFive
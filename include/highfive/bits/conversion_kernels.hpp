@@ -0,0 +1,436 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <H5Tpublic.h>
+
+#include "h5d_wrapper.hpp"
+#include "h5t_wrapper.hpp"
+#include "../H5Allocator.hpp"
+#include "../H5DataType.hpp"
+#include "../H5TransferBuffer.hpp"
+
+/// \brief Set to `1` to convert common numeric types with HighFive's kernels.
+///
+/// If the datatype in memory differs from the datatype of the dataset, e.g.
+/// when reading `double`s into `std::vector<float>` or reading big-endian
+/// integers, HDF5 converts every value with its generic converters. If this
+/// macro is `1`, `read` and `write` of datasets instead transfer the values
+/// in the datatype of the dataset through a staging buffer, and convert them
+/// with loops that the compiler vectorizes. On x86, a version using AVX2 is
+/// selected at runtime, if the CPU supports it. Selections of more than
+/// `details::max_conversion_staging_bytes` are still converted by HDF5.
+///
+/// The kernels swap the bytes of integers and IEEE floats; convert `float`
+/// to `double` and back; integers to floats; and integers to larger integers
+/// that can represent every value. All other conversions are left to HDF5.
+/// The results are the same as HDF5's.
+///
+/// Must be defined consistently before including any HighFive header.
+#ifndef HIGHFIVE_CONVERSION_KERNELS
+#define HIGHFIVE_CONVERSION_KERNELS 0
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HIGHFIVE_CONVERSION_KERNELS_X86 1
+#define HIGHFIVE_CONVERSION_KERNELS_INLINE inline __attribute__((always_inline))
+#else
+#define HIGHFIVE_CONVERSION_KERNELS_X86 0
+#define HIGHFIVE_CONVERSION_KERNELS_INLINE inline
+#endif
+
+namespace HighFive {
+namespace details {
+
+// Converts `n` values from `src` to `dst`; neither needs to be aligned.
+using conversion_kernel = void (*)(const void* src, void* dst, size_t n);
+
+#if HIGHFIVE_CONVERSION_KERNELS
+
+template <size_t Size>
+struct unsigned_of_size;
+
+template <>
+struct unsigned_of_size<1> {
+    using type = uint8_t;
+};
+
+template <>
+struct unsigned_of_size<2> {
+    using type = uint16_t;
+};
+
+template <>
+struct unsigned_of_size<4> {
+    using type = uint32_t;
+};
+
+template <>
+struct unsigned_of_size<8> {
+    using type = uint64_t;
+};
+
+// Written with shifts, which compilers recognize and vectorize.
+inline uint8_t byte_swap(uint8_t x) noexcept {
+    return x;
+}
+
+inline uint16_t byte_swap(uint16_t x) noexcept {
+    return uint16_t((x >> 8) | (x << 8));
+}
+
+inline uint32_t byte_swap(uint32_t x) noexcept {
+    return ((x & 0xff000000u) >> 24) | ((x & 0x00ff0000u) >> 8) | ((x & 0x0000ff00u) << 8) |
+           (x << 24);
+}
+
+inline uint64_t byte_swap(uint64_t x) noexcept {
+    return (uint64_t(byte_swap(uint32_t(x))) << 32) | byte_swap(uint32_t(x >> 32));
+}
+
+template <class T, bool Swap>
+HIGHFIVE_CONVERSION_KERNELS_INLINE T swap_value(T value) noexcept {
+    if (!Swap) {
+        return value;
+    }
+
+    using bits_type = typename unsigned_of_size<sizeof(T)>::type;
+    bits_type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    bits = byte_swap(bits);
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+template <class S, class D>
+HIGHFIVE_CONVERSION_KERNELS_INLINE D convert_value(S value) noexcept {
+    return static_cast<D>(value);
+}
+
+// Like HDF5, values too large for a `float` become infinite. The check
+// compares the bits, since compilers don't vectorize branches on `double`s
+// that might trap.
+template <>
+HIGHFIVE_CONVERSION_KERNELS_INLINE float convert_value<double, float>(double value) noexcept {
+    const uint64_t sign = 0x8000000000000000u;
+    const uint64_t infinity = 0x7ff0000000000000u;
+    const uint64_t max = 0x47efffffe0000000u;  // `double(FLT_MAX)`
+
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    auto magnitude = bits & ~sign;
+    bits = magnitude > max && magnitude < infinity ? (bits & sign) | infinity : bits;
+    std::memcpy(&value, &bits, sizeof(bits));
+    return static_cast<float>(value);
+}
+
+template <class S, class D, bool SwapSrc, bool SwapDst>
+HIGHFIVE_CONVERSION_KERNELS_INLINE D convert_one(S value) noexcept {
+    return swap_value<D, SwapDst>(convert_value<S, D>(swap_value<S, SwapSrc>(value)));
+}
+
+// The values are copied to and from local arrays, which can't alias; hence,
+// the loop of fixed length in between is vectorized, even by `-O2`.
+template <class S, class D, bool SwapSrc, bool SwapDst>
+HIGHFIVE_CONVERSION_KERNELS_INLINE void convert_blocks(const void* src,
+                                                       void* dst,
+                                                       size_t n) noexcept {
+    const auto* s = static_cast<const uint8_t*>(src);
+    auto* d = static_cast<uint8_t*>(dst);
+
+    S in[64];
+    D out[64];
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        std::memcpy(in, s + i * sizeof(S), sizeof(in));
+        for (size_t j = 0; j < 64; ++j) {
+            out[j] = convert_one<S, D, SwapSrc, SwapDst>(in[j]);
+        }
+        std::memcpy(d + i * sizeof(D), out, sizeof(out));
+    }
+
+    for (; i < n; ++i) {
+        std::memcpy(in, s + i * sizeof(S), sizeof(S));
+        out[0] = convert_one<S, D, SwapSrc, SwapDst>(in[0]);
+        std::memcpy(d + i * sizeof(D), out, sizeof(D));
+    }
+}
+
+template <class S, class D, bool SwapSrc, bool SwapDst>
+void convert_portable(const void* src, void* dst, size_t n) {
+    convert_blocks<S, D, SwapSrc, SwapDst>(src, dst, n);
+}
+
+#if HIGHFIVE_CONVERSION_KERNELS_X86
+template <class S, class D, bool SwapSrc, bool SwapDst>
+__attribute__((target("avx2"))) void convert_avx2(const void* src, void* dst, size_t n) {
+    convert_blocks<S, D, SwapSrc, SwapDst>(src, dst, n);
+}
+#endif
+
+inline bool has_avx2() noexcept {
+#if HIGHFIVE_CONVERSION_KERNELS_X86
+    static const bool is_supported = __builtin_cpu_supports("avx2") != 0;
+    return is_supported;
+#else
+    return false;
+#endif
+}
+
+template <class S, class D, bool SwapSrc, bool SwapDst>
+conversion_kernel select_kernel() noexcept {
+#if HIGHFIVE_CONVERSION_KERNELS_X86
+    if (has_avx2()) {
+        return &convert_avx2<S, D, SwapSrc, SwapDst>;
+    }
+#endif
+    return &convert_portable<S, D, SwapSrc, SwapDst>;
+}
+
+// Whether the kernels convert `S` to `D` exactly like HDF5.
+template <class S, class D>
+struct has_conversion_kernel {
+    static constexpr bool value =
+        std::is_same<S, D>::value ||
+        (std::is_floating_point<S>::value && std::is_floating_point<D>::value) ||
+        (std::is_integral<S>::value && std::is_floating_point<D>::value) ||
+        (std::is_integral<S>::value && std::is_integral<D>::value && sizeof(D) > sizeof(S) &&
+         (std::is_signed<D>::value || std::is_unsigned<S>::value));
+};
+
+template <class S, class D>
+conversion_kernel kernel_for(bool swap_src, bool swap_dst, std::true_type) noexcept {
+    if (swap_src) {
+        return select_kernel<S, D, true, false>();
+    }
+    if (swap_dst) {
+        return select_kernel<S, D, false, true>();
+    }
+    return select_kernel<S, D, false, false>();
+}
+
+template <class S, class D>
+conversion_kernel kernel_for(bool /* swap_src */, bool /* swap_dst */, std::false_type) noexcept {
+    return nullptr;
+}
+
+enum class ScalarKind { Signed, Unsigned, Float };
+
+// A plain integer or IEEE float, possibly of the other byte order.
+struct ScalarLayout {
+    ScalarKind kind;
+    size_t size;
+    bool is_swapped;
+};
+
+inline bool get_scalar_layout(const DataType& datatype, ScalarLayout& layout) {
+    auto type_id = datatype.getId();
+    auto type_class = detail::h5t_get_class(type_id);
+    if (type_class != H5T_INTEGER && type_class != H5T_FLOAT) {
+        return false;
+    }
+
+    auto order = detail::h5t_get_order(type_id);
+    if (order != H5T_ORDER_LE && order != H5T_ORDER_BE) {
+        return false;
+    }
+
+    auto size = size_t(detail::h5t_get_size(type_id));
+    auto is_big_endian = order == H5T_ORDER_BE;
+    layout.size = size;
+    layout.is_swapped = order != detail::h5t_get_order(H5T_NATIVE_INT);
+
+    // The reference type excludes, e.g., padding bits and custom floats.
+    hid_t reference = H5I_INVALID_HID;
+    if (type_class == H5T_INTEGER) {
+        auto is_signed = detail::h5t_get_sign(type_id) == H5T_SGN_2;
+        layout.kind = is_signed ? ScalarKind::Signed : ScalarKind::Unsigned;
+
+        const hid_t references[2][2][4] = {
+            {{H5T_STD_U8LE, H5T_STD_U16LE, H5T_STD_U32LE, H5T_STD_U64LE},
+             {H5T_STD_U8BE, H5T_STD_U16BE, H5T_STD_U32BE, H5T_STD_U64BE}},
+            {{H5T_STD_I8LE, H5T_STD_I16LE, H5T_STD_I32LE, H5T_STD_I64LE},
+             {H5T_STD_I8BE, H5T_STD_I16BE, H5T_STD_I32BE, H5T_STD_I64BE}}};
+        size_t index = size == 1 ? 0 : size == 2 ? 1 : size == 4 ? 2 : size == 8 ? 3 : 4;
+        if (index == 4) {
+            return false;
+        }
+        reference = references[is_signed][is_big_endian][index];
+    } else {
+        layout.kind = ScalarKind::Float;
+        if (size == 4) {
+            reference = is_big_endian ? H5T_IEEE_F32BE : H5T_IEEE_F32LE;
+        } else if (size == 8) {
+            reference = is_big_endian ? H5T_IEEE_F64BE : H5T_IEEE_F64LE;
+        } else {
+            return false;
+        }
+    }
+
+    return detail::h5t_equal(type_id, reference) > 0;
+}
+
+template <class T>
+struct scalar_tag {
+    using type = T;
+};
+
+// Calls `f` with a `scalar_tag` of the C++ type of `layout`.
+template <class F>
+conversion_kernel with_scalar_type(const ScalarLayout& layout, F&& f) {
+    switch (layout.kind) {
+    case ScalarKind::Signed:
+        switch (layout.size) {
+        case 1:
+            return f(scalar_tag<int8_t>());
+        case 2:
+            return f(scalar_tag<int16_t>());
+        case 4:
+            return f(scalar_tag<int32_t>());
+        default:
+            return f(scalar_tag<int64_t>());
+        }
+    case ScalarKind::Unsigned:
+        switch (layout.size) {
+        case 1:
+            return f(scalar_tag<uint8_t>());
+        case 2:
+            return f(scalar_tag<uint16_t>());
+        case 4:
+            return f(scalar_tag<uint32_t>());
+        default:
+            return f(scalar_tag<uint64_t>());
+        }
+    default:
+        if (layout.size == 4) {
+            return f(scalar_tag<float>());
+        }
+        return f(scalar_tag<double>());
+    }
+}
+
+///
+/// \brief The kernel converting `src` to `dst`; or `nullptr`, if HDF5 must convert.
+///
+/// Also `nullptr` if no conversion is needed.
+inline conversion_kernel find_conversion_kernel(const DataType& src, const DataType& dst) {
+    if (src == dst) {
+        return nullptr;
+    }
+
+    ScalarLayout s;
+    ScalarLayout d;
+    if (!get_scalar_layout(src, s) || !get_scalar_layout(dst, d)) {
+        return nullptr;
+    }
+
+    bool is_same = s.kind == d.kind && s.size == d.size && s.is_swapped == d.is_swapped;
+    if (is_same || (s.is_swapped && d.is_swapped)) {
+        return nullptr;
+    }
+
+    return with_scalar_type(s, [&s, &d](auto s_tag) {
+        return with_scalar_type(d, [&s, &d](auto d_tag) {
+            using S = typename decltype(s_tag)::type;
+            using D = typename decltype(d_tag)::type;
+            return kernel_for<S, D>(s.is_swapped,
+                                    d.is_swapped,
+                                    std::integral_constant<bool,
+                                                           has_conversion_kernel<S, D>::value>());
+        });
+    });
+}
+
+// Larger selections are converted by HDF5, piece by piece, since staging all
+// of it, and converting it afterwards, is no faster.
+const size_t max_conversion_staging_bytes = size_t(8) << 20;
+
+// Whether `n_elements` of `datatype` are few enough to be staged.
+inline bool is_stageable(size_t n_elements, const DataType& datatype) {
+    return n_elements != 0 && n_elements <= max_conversion_staging_bytes / datatype.getSize();
+}
+
+// Stages `n_bytes` in `transfer_buffer`, if not `nullptr`, or in `owned`.
+inline uint8_t* allocate_staging(size_t n_bytes,
+                                 TransferBuffer* transfer_buffer,
+                                 uninitialized_vector<uint8_t>& owned) {
+    if (transfer_buffer != nullptr) {
+        return TransferBufferAccess::allocate<uint8_t>(*transfer_buffer, n_bytes);
+    }
+
+    owned.resize(n_bytes);
+    return owned.data();
+}
+
+///
+/// \brief `H5Dread` into `buffer`, converting with a kernel if possible.
+///
+/// If a kernel converts `file_datatype` to `mem_datatype`, the `n_elements`
+/// selected are read in the datatype of the file into a staging buffer, and
+/// converted into `buffer`; unless more than `max_conversion_staging_bytes`
+/// would be staged. Returns the number of bytes staged.
+inline size_t read_converting(hid_t dataset_id,
+                              const DataType& mem_datatype,
+                              const DataType& file_datatype,
+                              hid_t mem_space_id,
+                              hid_t file_space_id,
+                              size_t n_elements,
+                              hid_t xfer_props_id,
+                              void* buffer,
+                              TransferBuffer* transfer_buffer) {
+    auto kernel = is_stageable(n_elements, file_datatype)
+                      ? find_conversion_kernel(file_datatype, mem_datatype)
+                      : nullptr;
+    if (kernel == nullptr) {
+        detail::h5d_read(
+            dataset_id, mem_datatype.getId(), mem_space_id, file_space_id, xfer_props_id, buffer);
+        return 0;
+    }
+
+    auto n_bytes = n_elements * file_datatype.getSize();
+    auto owned = uninitialized_vector<uint8_t>{};
+    auto* staging = allocate_staging(n_bytes, transfer_buffer, owned);
+    detail::h5d_read(
+        dataset_id, file_datatype.getId(), mem_space_id, file_space_id, xfer_props_id, staging);
+    kernel(staging, buffer, n_elements);
+    return n_bytes;
+}
+
+///
+/// \brief `H5Dwrite` from `buffer`, converting with a kernel if possible.
+///
+/// See `read_converting`.
+inline size_t write_converting(hid_t dataset_id,
+                               const DataType& mem_datatype,
+                               const DataType& file_datatype,
+                               hid_t mem_space_id,
+                               hid_t file_space_id,
+                               size_t n_elements,
+                               hid_t xfer_props_id,
+                               const void* buffer,
+                               TransferBuffer* transfer_buffer) {
+    auto kernel = is_stageable(n_elements, file_datatype)
+                      ? find_conversion_kernel(mem_datatype, file_datatype)
+                      : nullptr;
+    if (kernel == nullptr) {
+        detail::h5d_write(
+            dataset_id, mem_datatype.getId(), mem_space_id, file_space_id, xfer_props_id, buffer);
+        return 0;
+    }
+
+    auto n_bytes = n_elements * file_datatype.getSize();
+    auto owned = uninitialized_vector<uint8_t>{};
+    auto* staging = allocate_staging(n_bytes, transfer_buffer, owned);
+    kernel(buffer, staging, n_elements);
+    detail::h5d_write(
+        dataset_id, file_datatype.getId(), mem_space_id, file_space_id, xfer_props_id, staging);
+    return n_bytes;
+}
+
+#endif
+
+}  // namespace details
+}  // namespace HighFive
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+#include <H5public.h>
+
+#include "../H5DataType.hpp"
+#include "h5_wrapper.hpp"
+#include "h5i_wrapper.hpp"
+
+namespace HighFive {
+namespace details {
+
+///
+/// \brief A process-wide cache of memory datatypes, keyed by C++ type.
+///
+/// Creating the memory datatype of `T` costs at least one `H5Tcopy`, and for
+/// compound types one `H5Tinsert` per member. Since the memory datatype of a
+/// C++ type never changes, the cache creates it once, on first use, and
+/// afterwards only hands out new references to the same HID.
+///
+/// The cached HIDs belong to the cache and are never closed by HighFive; HDF5
+/// releases them when the library shuts down. Starting with HDF5 1.14 the
+/// cache registers a callback with `H5atclose` and repopulates itself after
+/// the library was closed and reopened. With older versions of HDF5, calling
+/// `H5close` explicitly and continuing to use HighFive afterwards requires
+/// calling `DataTypeCache::clear()` after `H5close`.
+///
+/// Datatypes of class `String` are never cached, because their character set
+/// may be modified in-place (see `enforce_ascii_hack`).
+///
+/// All methods are thread-safe.
+///
+class DataTypeCache {
+  public:
+    /// \brief Equivalent to `create_datatype<T>()`.
+    template <class T>
+    static DataType get() {
+        return lookup<&create_datatype<T>>();
+    }
+
+    /// \brief Equivalent to `create_and_check_datatype<T>()`.
+    template <class T>
+    static DataType getChecked() {
+        return lookup<&create_and_check_datatype<T>>();
+    }
+
+    /// \brief Forget all cached datatypes.
+    ///
+    /// The cached HIDs are not released, i.e. this is meant to be called
+    /// after the HDF5 library has been closed.
+    static void clear() noexcept {
+        generation().fetch_add(1, std::memory_order_acq_rel);
+    }
+
+  private:
+    struct Slot {
+        std::mutex mutex;
+        std::atomic<uint64_t> generation{0};
+        hid_t hid = H5I_INVALID_HID;
+    };
+
+    // Slots are valid only if their generation matches the global one,
+    // which starts at `1` such that default constructed slots are stale.
+    static std::atomic<uint64_t>& generation() {
+        static std::atomic<uint64_t> current{1};
+        return current;
+    }
+
+    template <DataType (*Create)()>
+    static DataType lookup() {
+        static Slot slot;
+
+        auto current = generation().load(std::memory_order_acquire);
+        if (slot.generation.load(std::memory_order_acquire) != current) {
+            std::lock_guard<std::mutex> lock(slot.mutex);
+            if (slot.generation.load(std::memory_order_relaxed) != current) {
+                auto dtype = Create();
+                if (dtype.empty() || dtype.getClass() == DataTypeClass::String) {
+                    return dtype;
+                }
+
+                registerAtClose(current);
+                detail::h5i_inc_ref(dtype.getId());
+                slot.hid = dtype.getId();
+                slot.generation.store(current, std::memory_order_release);
+                return dtype;
+            }
+        }
+
+        detail::h5i_inc_ref(slot.hid);
+        return detail::make_data_type(slot.hid);
+    }
+
+    static void registerAtClose(uint64_t current) {
+#if H5_VERSION_GE(1, 14, 0)
+        // The callbacks are dropped when the library shuts down. Hence, one
+        // registration is needed per library session, i.e. per generation.
+        static std::atomic<uint64_t> registered{0};
+        auto previous = registered.load(std::memory_order_acquire);
+        if (previous != current &&
+            registered.compare_exchange_strong(previous, current, std::memory_order_acq_rel)) {
+            detail::h5_atclose([](void*) { DataTypeCache::clear(); }, nullptr);
+        }
+#else
+        (void) current;
+#endif
+    }
+};
+
+}  // namespace details
+}  // namespace HighFive
@@ -0,0 +1,337 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <H5FDsec2.h>
+
+#include "H5Converter_misc.hpp"
+#include "H5Inspector_misc.hpp"
+#include "H5ReadWrite_misc.hpp"
+#include "compute_total_size.hpp"
+#include "datatype_cache.hpp"
+#include "h5f_wrapper.hpp"
+#include "h5p_wrapper.hpp"
+#include "posix_io.hpp"
+#include "../H5Exception.hpp"
+#include "../H5File.hpp"
+#include "../H5PropertyList.hpp"
+#include "../H5Utility.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+inline DirectReaderBase::DirectReaderBase(const DataSet& dataset, const DataType& mem_datatype)
+    : _path(dataset.getPath())
+    , _datatype(dataset.getDataType())
+    , _dims(dataset.getDimensions())
+    , _element_size(_datatype.getSize())
+    , _fill_value(_element_size, 0) {
+    auto fail = [this](const std::string& reason) {
+        throw DataSetException("Unable to read '" + _path + "' directly: " + reason + ".");
+    };
+
+    if (_datatype.isVariableStr() || _datatype.isReference() ||
+        _datatype.getClass() == DataTypeClass::VarLen) {
+        fail("variable length types aren't supported");
+    }
+
+    if (mem_datatype != _datatype) {
+        throw DataTypeException("Unable to read '" + _path +
+                                "' directly: the datatype in memory '" + mem_datatype.string() +
+                                "' differs from the datatype of the dataset '" +
+                                _datatype.string() + "'.");
+    }
+
+    if (_dims.empty()) {
+        fail("scalar datasets aren't supported");
+    }
+
+    auto create_props = dataset.getCreatePropertyList();
+    if (detail::h5p_get_nfilters(create_props.getId()) != 0) {
+        fail("the dataset is filtered");
+    }
+    if (detail::h5p_get_external_count(create_props.getId()) != 0) {
+        fail("the dataset is stored in external files");
+    }
+
+    const auto& file = dataset.getFile();
+    if (detail::h5p_get_driver(file.getAccessPropertyList().getId()) != H5FD_SEC2) {
+        fail("only files using the default driver can be read directly");
+    }
+
+    H5D_fill_value_t status;
+    detail::h5p_fill_value_defined(create_props.getId(), &status);
+    if (status != H5D_FILL_VALUE_UNDEFINED) {
+        detail::h5p_get_fill_value(create_props.getId(), _datatype.getId(), _fill_value.data());
+    }
+
+    auto layout = detail::h5p_get_layout(create_props.getId());
+    if (layout == H5D_CONTIGUOUS) {
+        _chunk_dims = _dims;
+        _n_chunks.assign(_dims.size(), 1);
+        _addresses.assign(1, dataset.getStorageSize() == 0 ? HADDR_UNDEF : dataset.getOffset());
+    } else if (layout == H5D_CHUNKED) {
+#if H5_VERSION_GE(1, 10, 5)
+        auto chunk_dims = Chunking(create_props).getDimensions();
+        _chunk_dims.assign(chunk_dims.begin(), chunk_dims.end());
+        for (size_t k = 0; k < _dims.size(); ++k) {
+            _n_chunks.push_back((_dims[k] + _chunk_dims[k] - 1) / _chunk_dims[k]);
+        }
+
+        _addresses.assign(compute_total_size(_n_chunks), HADDR_UNDEF);
+        for (const auto& chunk: dataset.listChunks()) {
+            size_t linear_index = 0;
+            for (size_t k = 0; k < _dims.size(); ++k) {
+                linear_index = linear_index * _n_chunks[k] + chunk.offset[k] / _chunk_dims[k];
+            }
+            _addresses[linear_index] = chunk.address;
+        }
+#else
+        fail("querying the addresses of chunks requires HDF5 1.10.5");
+#endif
+    } else {
+        fail("only contiguous and chunked datasets can be read directly");
+    }
+
+    // Data still cached by HDF5 must reach the file first.
+    detail::h5f_flush(dataset.getId(), H5F_SCOPE_LOCAL);
+    _fd = open_read_only(file.getName());
+}
+
+inline DirectReaderBase::DirectReaderBase(DirectReaderBase&& other) noexcept
+    : _path(std::move(other._path))
+    , _datatype(std::move(other._datatype))
+    , _dims(std::move(other._dims))
+    , _element_size(other._element_size)
+    , _fill_value(std::move(other._fill_value))
+    , _chunk_dims(std::move(other._chunk_dims))
+    , _n_chunks(std::move(other._n_chunks))
+    , _addresses(std::move(other._addresses))
+    , _fd(other._fd) {
+    other._fd = -1;
+}
+
+inline DirectReaderBase& DirectReaderBase::operator=(DirectReaderBase&& other) noexcept {
+    if (this != &other) {
+        std::swap(_path, other._path);
+        std::swap(_datatype, other._datatype);
+        std::swap(_dims, other._dims);
+        std::swap(_element_size, other._element_size);
+        std::swap(_fill_value, other._fill_value);
+        std::swap(_chunk_dims, other._chunk_dims);
+        std::swap(_n_chunks, other._n_chunks);
+        std::swap(_addresses, other._addresses);
+        std::swap(_fd, other._fd);
+    }
+    return *this;
+}
+
+inline DirectReaderBase::~DirectReaderBase() {
+    if (_fd >= 0) {
+        HIGHFIVE_LOG_ERROR_IF(!close_file(_fd), "Failed to close the file of '" + _path + "'.");
+    }
+}
+
+inline void DirectReaderBase::checkBlock(const std::vector<size_t>& offset,
+                                         const std::vector<size_t>& count) const {
+    bool is_inside = offset.size() == _dims.size() && count.size() == _dims.size();
+    for (size_t k = 0; is_inside && k < _dims.size(); ++k) {
+        is_inside = offset[k] + count[k] <= _dims[k];
+    }
+
+    if (!is_inside) {
+        throw DataSpaceException("Unable to read the block at " + format_vector(offset) +
+                                 " of size " + format_vector(count) + " from '" + _path +
+                                 "' of dimensions " + format_vector(_dims) + ".");
+    }
+}
+
+inline void DirectReaderBase::fill(uint8_t* buffer, size_t n_bytes) const noexcept {
+    for (size_t i = 0; i < n_bytes; i += _element_size) {
+        std::memcpy(buffer + i, _fill_value.data(), _element_size);
+    }
+}
+
+inline void DirectReaderBase::readBytes(const HyperSlabBlocks& blocks, uint8_t* buffer) const {
+    auto rank = _dims.size();
+    auto first = std::vector<size_t>(rank);
+    auto last = std::vector<size_t>(rank);
+    auto chunk = std::vector<size_t>(rank);
+    auto chunk_offset = std::vector<size_t>(rank);
+    auto lower = std::vector<size_t>(rank);
+    auto upper = std::vector<size_t>(rank);
+    auto point = std::vector<size_t>(rank);
+
+    // Rows that are consecutive both in the file and in `buffer` are read
+    // with a single `pread`.
+    uint8_t* run_dst = nullptr;
+    uint64_t run_src = 0;
+    size_t run_bytes = 0;
+    auto read_run = [this, &run_dst, &run_src, &run_bytes]() {
+        if (run_bytes != 0) {
+            pread_all(_fd, run_dst, run_bytes, run_src);
+            run_bytes = 0;
+        }
+    };
+
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        const auto* block_lower = blocks.getLower(b);
+        const auto* block_upper = blocks.getUpper(b);
+
+        bool is_empty = false;
+        for (size_t k = 0; k < rank; ++k) {
+            is_empty = is_empty || block_upper[k] <= block_lower[k];
+        }
+        if (is_empty) {
+            continue;
+        }
+
+        for (size_t k = 0; k < rank; ++k) {
+            first[k] = block_lower[k] / _chunk_dims[k];
+            last[k] = (block_upper[k] - 1) / _chunk_dims[k];
+        }
+
+        chunk = first;
+        while (true) {
+            size_t linear_index = 0;
+            for (size_t k = 0; k < rank; ++k) {
+                linear_index = linear_index * _n_chunks[k] + chunk[k];
+                chunk_offset[k] = chunk[k] * _chunk_dims[k];
+                lower[k] = std::max(block_lower[k], chunk_offset[k]);
+                upper[k] = std::min(block_upper[k], chunk_offset[k] + _chunk_dims[k]);
+            }
+            auto address = _addresses[linear_index];
+
+            // Within a block, the elements of a row are consecutive in `buffer`.
+            auto row_bytes = (upper[rank - 1] - lower[rank - 1]) * _element_size;
+            point = lower;
+
+            while (true) {
+                auto* dst = buffer + blocks.countPreceding(point) * _element_size;
+                if (address == HADDR_UNDEF) {
+                    fill(dst, row_bytes);
+                } else {
+                    size_t src = 0;
+                    for (size_t k = 0; k < rank; ++k) {
+                        src = src * _chunk_dims[k] + point[k] - chunk_offset[k];
+                    }
+
+                    auto position = address + src * _element_size;
+                    if (run_bytes != 0 && run_dst + run_bytes == dst &&
+                        run_src + run_bytes == position) {
+                        run_bytes += row_bytes;
+                    } else {
+                        read_run();
+                        run_dst = dst;
+                        run_src = position;
+                        run_bytes = row_bytes;
+                    }
+                }
+
+                size_t k = rank - 1;
+                for (; k > 0; --k) {
+                    if (++point[k - 1] < upper[k - 1]) {
+                        break;
+                    }
+                    point[k - 1] = lower[k - 1];
+                }
+
+                if (k == 0) {
+                    break;
+                }
+            }
+
+            size_t k = rank;
+            for (; k > 0; --k) {
+                if (++chunk[k - 1] <= last[k - 1]) {
+                    break;
+                }
+                chunk[k - 1] = first[k - 1];
+            }
+
+            if (k == 0) {
+                break;
+            }
+        }
+    }
+
+    read_run();
+}
+
+}  // namespace details
+
+template <class T>
+inline DirectReader<T>::DirectReader(const DataSet& dataset)
+    : details::DirectReaderBase(dataset, details::DataTypeCache::getChecked<T>()) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable types can be read directly.");
+}
+
+template <class T>
+template <class Container>
+inline void DirectReader<T>::read(Container& array) const {
+    auto space = DataSpace(_dims);
+    read(space, space, array);
+}
+
+template <class T>
+template <class Container>
+inline void DirectReader<T>::read(const Selection& selection, Container& array) const {
+    read(selection.getSpace(), selection.getMemSpace(), array);
+}
+
+template <class T>
+inline void DirectReader<T>::read_raw(T* array) const {
+    readBytes(details::HyperSlabBlocks(std::vector<size_t>(_dims.size(), 0), _dims),
+              reinterpret_cast<uint8_t*>(array));
+}
+
+template <class T>
+inline void DirectReader<T>::read_raw(const Selection& selection, T* array) const {
+    readBytes(details::HyperSlabBlocks(selection.getSpace()), reinterpret_cast<uint8_t*>(array));
+}
+
+template <class T>
+inline void DirectReader<T>::read_raw(const std::vector<size_t>& offset,
+                                      const std::vector<size_t>& count,
+                                      T* array) const {
+    checkBlock(offset, count);
+    readBytes(details::HyperSlabBlocks(offset, count), reinterpret_cast<uint8_t*>(array));
+}
+
+template <class T>
+template <class Container>
+inline void DirectReader<T>::read(const DataSpace& file_space,
+                                  const DataSpace& mem_space,
+                                  Container& array) const {
+    static_assert(!std::is_const<Container>::value,
+                  "read() requires a non-const structure to read data into");
+    static_assert(std::is_same<typename details::inspector<Container>::base_type, T>::value,
+                  "The elements of the container must be of type `T`.");
+
+    const details::BufferInfo<Container> buffer_info(
+        _datatype,
+        [this]() -> std::string { return _path; },
+        details::BufferInfo<Container>::Operation::read);
+
+    if (!details::checkDimensions(mem_space, buffer_info.getMinRank(), buffer_info.getMaxRank())) {
+        std::ostringstream ss;
+        ss << "Impossible to read DataSet of dimensions " << mem_space.getNumberDimensions()
+           << " into arrays of dimensions: " << buffer_info.getMinRank() << "(min) to "
+           << buffer_info.getMaxRank() << "(max)";
+        throw DataSpaceException(ss.str());
+    }
+
+    auto dims = mem_space.getDimensions();
+    auto r = details::data_converter::get_reader<Container>(dims, array, _datatype);
+    readBytes(details::HyperSlabBlocks(file_space), reinterpret_cast<uint8_t*>(r.getPointer()));
+    r.unserialize(array);
+}
+
+}  // namespace HighFive
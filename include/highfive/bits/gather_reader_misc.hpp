@@ -0,0 +1,248 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "H5Utils.hpp"
+#include "compute_total_size.hpp"
+#include "datatype_cache.hpp"
+#include "h5d_wrapper.hpp"
+#include "h5p_wrapper.hpp"
+#include "h5s_wrapper.hpp"
+#include "../H5Exception.hpp"
+#include "../H5Instrumentation.hpp"
+#include "../H5PropertyList.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+inline GatherReaderBase::GatherReaderBase(const DataSet& dataset,
+                                          const DataType& mem_datatype,
+                                          size_t max_staging_bytes)
+    : _dataset(dataset)
+    , _mem_datatype(mem_datatype)
+    , _file_space(dataset.getSpace())
+    , _dims(_file_space.getDimensions())
+    , _element_size(mem_datatype.getSize())
+    , _max_staging_bytes(std::max(max_staging_bytes, _element_size)) {
+    if (_dims.empty()) {
+        throw DataSetException("Unable to gather elements of '" + dataset.getPath() +
+                               "': scalar datasets aren't supported.");
+    }
+
+    auto create_props = dataset.getCreatePropertyList();
+    if (detail::h5p_get_layout(create_props.getId()) == H5D_CHUNKED) {
+        auto chunk_dims = Chunking(create_props).getDimensions();
+        _tile_dims.assign(chunk_dims.begin(), chunk_dims.end());
+    } else {
+        _tile_dims.assign(_dims.size(), 1);
+        _tile_dims.back() = std::max(size_t(1),
+                                     std::min(_dims.back(), _max_staging_bytes / _element_size));
+    }
+
+    for (size_t k = 0; k < _dims.size(); ++k) {
+        _n_tiles.push_back((_dims[k] + _tile_dims[k] - 1) / _tile_dims[k]);
+    }
+}
+
+inline void GatherReaderBase::gatherBytes(const size_t* coordinates,
+                                          size_t n_points,
+                                          uint8_t* buffer) {
+    _n_reads = 0;
+    _n_staged_bytes = 0;
+    if (n_points == 0) {
+        return;
+    }
+
+    HIGHFIVE_INSTRUMENT(IOOperation::Read, _dataset.getPath(), n_points * _element_size)
+
+    // Sort the points by tile, and within a tile in row-major order.
+    auto rank = _dims.size();
+    auto keys = std::vector<std::pair<size_t, size_t>>(n_points);
+    for (size_t i = 0; i < n_points; ++i) {
+        const auto* point = coordinates + i * rank;
+
+        size_t tile = 0;
+        size_t offset = 0;
+        for (size_t k = 0; k < rank; ++k) {
+            if (point[k] >= _dims[k]) {
+                throw DataSpaceException(
+                    "Unable to read the point " +
+                    format_vector(std::vector<size_t>(point, point + rank)) + " from '" +
+                    _dataset.getPath() + "' of dimensions " + format_vector(_dims) + ".");
+            }
+            tile = tile * _n_tiles[k] + point[k] / _tile_dims[k];
+            offset = offset * _dims[k] + point[k];
+        }
+        keys[i] = {tile, offset};
+    }
+
+    auto order = std::vector<size_t>(n_points);
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [&keys](size_t a, size_t b) {
+        return keys[a] < keys[b];
+    });
+
+    // Isolated points, and points spread too far within their tile, are
+    // read with element selections, in sorted order.
+    auto points = std::vector<size_t>{};
+    for (size_t begin = 0; begin < n_points;) {
+        auto tile = keys[order[begin]].first;
+        auto end = begin + 1;
+        while (end < n_points && keys[order[end]].first == tile) {
+            ++end;
+        }
+
+        if (end - begin == 1 || !readTile(coordinates, order, begin, end, buffer)) {
+            points.insert(points.end(),
+                          order.begin() + std::ptrdiff_t(begin),
+                          order.begin() + std::ptrdiff_t(end));
+        }
+        begin = end;
+    }
+
+    readPoints(coordinates, points, buffer);
+    HIGHFIVE_INSTRUMENT_STAGED(_n_staged_bytes)
+}
+
+inline bool GatherReaderBase::readTile(const size_t* coordinates,
+                                       const std::vector<size_t>& order,
+                                       size_t begin,
+                                       size_t end,
+                                       uint8_t* buffer) {
+    auto rank = _dims.size();
+    const auto* first = coordinates + order[begin] * rank;
+    auto lower = std::vector<size_t>(first, first + rank);
+    auto upper = lower;
+    for (size_t j = begin + 1; j < end; ++j) {
+        const auto* point = coordinates + order[j] * rank;
+        for (size_t k = 0; k < rank; ++k) {
+            lower[k] = std::min(lower[k], point[k]);
+            upper[k] = std::max(upper[k], point[k]);
+        }
+    }
+
+    auto count = std::vector<size_t>(rank);
+    for (size_t k = 0; k < rank; ++k) {
+        count[k] = upper[k] - lower[k] + 1;
+    }
+
+    if (compute_total_size(count) * _element_size > _max_staging_bytes) {
+        return false;
+    }
+
+    auto offset = toHDF5SizeVector(lower);
+    auto hdf5_count = toHDF5SizeVector(count);
+    detail::h5s_select_hyperslab(_file_space.getId(),
+                                 H5S_SELECT_SET,
+                                 offset.data(),
+                                 nullptr,
+                                 hdf5_count.data(),
+                                 nullptr);
+
+    _staging.resize(compute_total_size(count) * _element_size);
+    auto mem_space = DataSpace(count);
+    detail::h5d_read(_dataset.getId(),
+                     _mem_datatype.getId(),
+                     mem_space.getId(),
+                     _file_space.getId(),
+                     H5P_DEFAULT,
+                     _staging.data());
+    ++_n_reads;
+    _n_staged_bytes += _staging.size();
+
+    for (size_t j = begin; j < end; ++j) {
+        const auto* point = coordinates + order[j] * rank;
+        size_t local = 0;
+        for (size_t k = 0; k < rank; ++k) {
+            local = local * count[k] + point[k] - lower[k];
+        }
+        std::memcpy(buffer + order[j] * _element_size,
+                    _staging.data() + local * _element_size,
+                    _element_size);
+    }
+    return true;
+}
+
+inline void GatherReaderBase::readPoints(const size_t* coordinates,
+                                         const std::vector<size_t>& points,
+                                         uint8_t* buffer) {
+    auto rank = _dims.size();
+    auto max_points = _max_staging_bytes / _element_size;
+    auto hdf5_coordinates = std::vector<hsize_t>{};
+
+    for (size_t batch = 0; batch < points.size(); batch += max_points) {
+        auto n_batch = std::min(max_points, points.size() - batch);
+
+        hdf5_coordinates.resize(n_batch * rank);
+        for (size_t j = 0; j < n_batch; ++j) {
+            const auto* point = coordinates + points[batch + j] * rank;
+            std::copy(point, point + rank, hdf5_coordinates.begin() + std::ptrdiff_t(j * rank));
+        }
+        detail::h5s_select_elements(_file_space.getId(),
+                                    H5S_SELECT_SET,
+                                    n_batch,
+                                    hdf5_coordinates.data());
+
+        _staging.resize(n_batch * _element_size);
+        auto mem_space = DataSpace(n_batch);
+        detail::h5d_read(_dataset.getId(),
+                         _mem_datatype.getId(),
+                         mem_space.getId(),
+                         _file_space.getId(),
+                         H5P_DEFAULT,
+                         _staging.data());
+        ++_n_reads;
+        _n_staged_bytes += _staging.size();
+
+        for (size_t j = 0; j < n_batch; ++j) {
+            std::memcpy(buffer + points[batch + j] * _element_size,
+                        _staging.data() + j * _element_size,
+                        _element_size);
+        }
+    }
+}
+
+}  // namespace details
+
+template <class T>
+inline GatherReader<T>::GatherReader(const DataSet& dataset, size_t max_staging_bytes)
+    : details::GatherReaderBase(dataset,
+                                details::DataTypeCache::getChecked<T>(),
+                                max_staging_bytes) {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Only trivially copyable types can be gathered.");
+}
+
+template <class T>
+inline void GatherReader<T>::read(const ElementSet& elements, std::vector<T>& values) {
+    auto rank = getDimensions().size();
+    if (elements._ids.size() % rank != 0) {
+        throw DataSpaceException(
+            "Number of coordinates in elements picking "
+            "should be a multiple of the dimensions.");
+    }
+
+    auto n_points = elements._ids.size() / rank;
+    values.resize(n_points);
+    read_raw(elements._ids.data(), n_points, values.data());
+}
+
+template <class T>
+inline std::vector<T> GatherReader<T>::read(const ElementSet& elements) {
+    auto values = std::vector<T>{};
+    read(elements, values);
+    return values;
+}
+
+template <class T>
+inline void GatherReader<T>::read_raw(const size_t* coordinates, size_t n_points, T* values) {
+    gatherBytes(coordinates, n_points, reinterpret_cast<uint8_t*>(values));
+}
+
+}  // namespace HighFive
@@ -9,6 +9,18 @@ inline void h5_free_memory(void* mem) {
     }
 }
 
+#if H5_VERSION_GE(1, 14, 0)
+inline herr_t h5_atclose(H5_atclose_func_t func, void* ctx) {
+    herr_t err = H5atclose(func, ctx);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<ObjectException>(
+            "Failed to register callback for library shutdown.");
+    }
+
+    return err;
+}
+#endif
+
 namespace nothrow {
 inline herr_t h5_free_memory(void* mem) {
     return H5free_memory(mem);
@@ -74,6 +74,40 @@ inline herr_t h5d_write(hid_t dset_id,
     return err;
 }
 
+#if H5_VERSION_GE(1, 14, 0)
+inline herr_t h5d_read_multi(size_t count,
+                             hid_t* dset_ids,
+                             hid_t* mem_type_ids,
+                             hid_t* mem_space_ids,
+                             hid_t* file_space_ids,
+                             hid_t dxpl_id,
+                             void** bufs) {
+    herr_t err = H5Dread_multi(
+        count, dset_ids, mem_type_ids, mem_space_ids, file_space_ids, dxpl_id, bufs);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(std::string("Unable to read the datasets"));
+    }
+
+    return err;
+}
+
+inline herr_t h5d_write_multi(size_t count,
+                              hid_t* dset_ids,
+                              hid_t* mem_type_ids,
+                              hid_t* mem_space_ids,
+                              hid_t* file_space_ids,
+                              hid_t dxpl_id,
+                              const void** bufs) {
+    herr_t err = H5Dwrite_multi(
+        count, dset_ids, mem_type_ids, mem_space_ids, file_space_ids, dxpl_id, bufs);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(std::string("Unable to write the datasets"));
+    }
+
+    return err;
+}
+#endif
+
 #if H5_VERSION_GE(1, 10, 0)
 inline herr_t h5d_flush(hid_t dset_id) {
     herr_t err = H5Dflush(dset_id);
@@ -96,6 +130,98 @@ inline herr_t h5d_refresh(hid_t dset_id) {
 }
 #endif
 
+#if H5_VERSION_GE(1, 10, 2)
+inline herr_t h5d_write_chunk(hid_t dset_id,
+                              hid_t dxpl_id,
+                              uint32_t filters,
+                              const hsize_t* offset,
+                              size_t data_size,
+                              const void* buf) {
+    herr_t err = H5Dwrite_chunk(dset_id, dxpl_id, filters, offset, data_size, buf);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Unable to write the raw chunk.");
+    }
+
+    return err;
+}
+
+inline herr_t h5d_read_chunk(hid_t dset_id,
+                             hid_t dxpl_id,
+                             const hsize_t* offset,
+                             uint32_t* filters,
+                             void* buf) {
+    herr_t err = H5Dread_chunk(dset_id, dxpl_id, offset, filters, buf);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Unable to read the raw chunk.");
+    }
+
+    return err;
+}
+
+inline herr_t h5d_get_chunk_storage_size(hid_t dset_id,
+                                         const hsize_t* offset,
+                                         hsize_t* chunk_bytes) {
+    herr_t err = H5Dget_chunk_storage_size(dset_id, offset, chunk_bytes);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            "Unable to get the storage size of the chunk.");
+    }
+
+    return err;
+}
+#endif
+
+#if H5_VERSION_GE(1, 10, 5)
+inline herr_t h5d_get_num_chunks(hid_t dset_id, hid_t fspace_id, hsize_t* nchunks) {
+    herr_t err = H5Dget_num_chunks(dset_id, fspace_id, nchunks);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Unable to get the number of chunks.");
+    }
+
+    return err;
+}
+
+inline herr_t h5d_get_chunk_info(hid_t dset_id,
+                                 hid_t fspace_id,
+                                 hsize_t chk_idx,
+                                 hsize_t* offset,
+                                 unsigned* filter_mask,
+                                 haddr_t* addr,
+                                 hsize_t* size) {
+    herr_t err = H5Dget_chunk_info(dset_id, fspace_id, chk_idx, offset, filter_mask, addr, size);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Unable to get the chunk info.");
+    }
+
+    return err;
+}
+
+inline herr_t h5d_get_chunk_info_by_coord(hid_t dset_id,
+                                          const hsize_t* offset,
+                                          unsigned* filter_mask,
+                                          haddr_t* addr,
+                                          hsize_t* size) {
+    herr_t err = H5Dget_chunk_info_by_coord(dset_id, offset, filter_mask, addr, size);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>(
+            "Unable to get the chunk info by coordinates.");
+    }
+
+    return err;
+}
+#endif
+
+#if H5_VERSION_GE(1, 14, 0)
+inline herr_t h5d_chunk_iter(hid_t dset_id, hid_t dxpl_id, H5D_chunk_iter_op_t cb, void* op_data) {
+    herr_t err = H5Dchunk_iter(dset_id, dxpl_id, cb, op_data);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSetException>("Unable to iterate over the chunks.");
+    }
+
+    return err;
+}
+#endif
+
 inline haddr_t h5d_get_offset(hid_t dset_id) {
     uint64_t addr = H5Dget_offset(dset_id);
     if (addr == HADDR_UNDEF) {
@@ -45,6 +45,14 @@ inline herr_t h5f_get_filesize(hid_t file_id, hsize_t* size) {
     return err;
 }
 
+inline ssize_t h5f_get_file_image(hid_t file_id, void* buf_ptr, size_t buf_len) {
+    ssize_t n_bytes = H5Fget_file_image(file_id, buf_ptr, buf_len);
+    if (n_bytes < 0) {
+        HDF5ErrMapper::ToException<FileException>(std::string("Unable to retrieve file image"));
+    }
+    return n_bytes;
+}
+
 inline hssize_t h5f_get_freespace(hid_t file_id) {
     hssize_t free_space = H5Fget_freespace(file_id);
     if (free_space < 0) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <H5Ipublic.h>
+#include <H5FDcore.h>
 #include <H5Ppublic.h>
 
 namespace HighFive {
@@ -155,6 +156,50 @@ inline herr_t h5p_set_libver_bounds(hid_t plist_id, H5F_libver_t low, H5F_libver
     return err;
 }
 
+inline herr_t h5p_set_fapl_core(hid_t fapl_id, size_t increment, hbool_t backing_store) {
+    herr_t err = H5Pset_fapl_core(fapl_id, increment, backing_store);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error setting core driver");
+    }
+    return err;
+}
+
+inline herr_t h5p_get_fapl_core(hid_t fapl_id, size_t* increment, hbool_t* backing_store) {
+    herr_t err = H5Pget_fapl_core(fapl_id, increment, backing_store);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting core driver");
+    }
+    return err;
+}
+
+inline herr_t h5p_set_file_image(hid_t fapl_id, void* buf_ptr, size_t buf_len) {
+    herr_t err = H5Pset_file_image(fapl_id, buf_ptr, buf_len);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error setting file image");
+    }
+    return err;
+}
+
+inline herr_t h5p_set_file_image_callbacks(hid_t fapl_id, H5FD_file_image_callbacks_t* callbacks) {
+    herr_t err = H5Pset_file_image_callbacks(fapl_id, callbacks);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error setting file image callbacks");
+    }
+    return err;
+}
+
+inline herr_t h5p_set_vlen_mem_manager(hid_t plist_id,
+                                      H5MM_allocate_t alloc_func,
+                                      void* alloc_info,
+                                      H5MM_free_t free_func,
+                                      void* free_info) {
+    herr_t err = H5Pset_vlen_mem_manager(plist_id, alloc_func, alloc_info, free_func, free_info);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error setting vlen memory manager");
+    }
+    return err;
+}
+
 inline herr_t h5p_get_meta_block_size(hid_t fapl_id, hsize_t* size) {
     herr_t err = H5Pget_meta_block_size(fapl_id, size);
     if (err < 0) {
@@ -207,6 +252,30 @@ inline herr_t h5p_set_chunk(hid_t plist_id, int ndims, const hsize_t dim[]) {
     return err;
 }
 
+inline H5D_layout_t h5p_get_layout(hid_t plist_id) {
+    H5D_layout_t layout = H5Pget_layout(plist_id);
+    if (layout < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting layout");
+    }
+    return layout;
+}
+
+inline int h5p_get_external_count(hid_t plist_id) {
+    int n_external = H5Pget_external_count(plist_id);
+    if (n_external < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting number of external files");
+    }
+    return n_external;
+}
+
+inline hid_t h5p_get_driver(hid_t plist_id) {
+    hid_t driver_id = H5Pget_driver(plist_id);
+    if (driver_id < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting file driver");
+    }
+    return driver_id;
+}
+
 inline int h5p_get_chunk(hid_t plist_id, int max_ndims, hsize_t dim[]) {
     int chunk_dims = H5Pget_chunk(plist_id, max_ndims, dim);
     if (chunk_dims < 0) {
@@ -247,6 +316,46 @@ inline herr_t h5p_set_shuffle(hid_t plist_id) {
     return err;
 }
 
+inline int h5p_get_nfilters(hid_t plist_id) {
+    int n_filters = H5Pget_nfilters(plist_id);
+    if (n_filters < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting number of filters");
+    }
+    return n_filters;
+}
+
+inline H5Z_filter_t h5p_get_filter2(hid_t plist_id,
+                                    unsigned idx,
+                                    unsigned* flags,
+                                    size_t* cd_nelmts,
+                                    unsigned cd_values[],
+                                    size_t namelen,
+                                    char name[],
+                                    unsigned* filter_config) {
+    H5Z_filter_t filter_id =
+        H5Pget_filter2(plist_id, idx, flags, cd_nelmts, cd_values, namelen, name, filter_config);
+    if (filter_id < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting filter");
+    }
+    return filter_id;
+}
+
+inline herr_t h5p_fill_value_defined(hid_t plist_id, H5D_fill_value_t* status) {
+    herr_t err = H5Pfill_value_defined(plist_id, status);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error checking if fill value is defined");
+    }
+    return err;
+}
+
+inline herr_t h5p_get_fill_value(hid_t plist_id, hid_t type_id, void* value) {
+    herr_t err = H5Pget_fill_value(plist_id, type_id, value);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<PropertyException>("Error getting fill value");
+    }
+    return err;
+}
+
 inline herr_t h5p_get_alloc_time(hid_t plist_id, H5D_alloc_time_t* alloc_time) {
     herr_t err = H5Pget_alloc_time(plist_id, alloc_time);
     if (err < 0) {
@@ -120,6 +120,50 @@ inline H5S_sel_type h5s_get_select_type(hid_t space_id) {
     return type;
 }
 
+inline hssize_t h5s_get_select_hyper_nblocks(hid_t space_id) {
+    hssize_t n_blocks = H5Sget_select_hyper_nblocks(space_id);
+    if (n_blocks < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to get number of hyperslab blocks.");
+    }
+
+    return n_blocks;
+}
+
+inline herr_t h5s_get_select_hyper_blocklist(hid_t space_id,
+                                             hsize_t startblock,
+                                             hsize_t numblocks,
+                                             hsize_t buf[]) {
+    herr_t err = H5Sget_select_hyper_blocklist(space_id, startblock, numblocks, buf);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to get hyperslab blocks.");
+    }
+
+    return err;
+}
+
+#if H5_VERSION_GE(1, 10, 0)
+inline htri_t h5s_is_regular_hyperslab(hid_t space_id) {
+    htri_t is_regular = H5Sis_regular_hyperslab(space_id);
+    if (is_regular < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>(
+            "Unable to check if the selection is a regular hyperslab.");
+    }
+    return is_regular;
+}
+
+inline herr_t h5s_get_regular_hyperslab(hid_t space_id,
+                                        hsize_t start[],
+                                        hsize_t stride[],
+                                        hsize_t count[],
+                                        hsize_t block[]) {
+    herr_t err = H5Sget_regular_hyperslab(space_id, start, stride, count, block);
+    if (err < 0) {
+        HDF5ErrMapper::ToException<DataSpaceException>("Unable to get regular hyperslab.");
+    }
+    return err;
+}
+#endif
+
 #if H5_VERSION_GE(1, 10, 6)
 inline hid_t h5s_combine_select(hid_t space1_id, H5S_seloper_t op, hid_t space2_id) {
     auto space_id = H5Scombine_select(space1_id, op, space2_id);
@@ -32,6 +32,14 @@ inline H5T_sign_t h5t_get_sign(hid_t type_id) {
     return sign;
 }
 
+inline H5T_order_t h5t_get_order(hid_t type_id) {
+    auto order = H5Tget_order(type_id);
+    if (order == H5T_ORDER_ERROR) {
+        HDF5ErrMapper::ToException<DataTypeException>("Error getting the byte order of datatype.");
+    }
+    return order;
+}
+
 inline H5T_cset_t h5t_get_cset(hid_t hid) {
     auto cset = H5Tget_cset(hid);
     if (cset == H5T_CSET_ERROR) {
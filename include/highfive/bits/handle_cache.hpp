@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include <H5Ipublic.h>
+
+#include "../H5Object.hpp"
+#include "h5i_wrapper.hpp"
+
+namespace HighFive {
+namespace details {
+
+///
+/// \brief An LRU cache of opened objects, keyed by their path.
+///
+/// The cache owns one reference to every cached HID and hands out new
+/// references on lookup. Hence, a hit costs an `H5Iinc_ref` instead of
+/// resolving the path through every group along the way. Paths are compared
+/// after stripping leading slashes, i.e. relative to the root group.
+///
+/// The cache only knows about modifications it's told about, see
+/// `invalidate` and `clear`.
+///
+class HandleCache {
+  public:
+    explicit HandleCache(size_t capacity)
+        : _capacity(capacity) {}
+
+    HandleCache(const HandleCache&) = delete;
+    HandleCache& operator=(const HandleCache&) = delete;
+
+    ~HandleCache() {
+        clear();
+    }
+
+    /// \brief Returns a new reference to the object at `path`, if it's cached
+    /// and of type `type`; otherwise `H5I_INVALID_HID`.
+    hid_t find(const std::string& path, ObjectType type) {
+        auto it = _index.find(key(path));
+        if (it == _index.end() || it->second->type != type) {
+            ++_n_misses;
+            return H5I_INVALID_HID;
+        }
+
+        ++_n_hits;
+        _entries.splice(_entries.begin(), _entries, it->second);
+        detail::h5i_inc_ref(it->second->hid);
+        return it->second->hid;
+    }
+
+    /// \brief Returns the type of the object at `path`, if it's cached.
+    bool findType(const std::string& path, ObjectType& type) {
+        auto it = _index.find(key(path));
+        if (it == _index.end()) {
+            ++_n_misses;
+            return false;
+        }
+
+        ++_n_hits;
+        _entries.splice(_entries.begin(), _entries, it->second);
+        type = it->second->type;
+        return true;
+    }
+
+    /// \brief Cache `hid`, as the object at `path`; evicts the least recently
+    /// used object if the cache is full.
+    void insert(const std::string& path, ObjectType type, hid_t hid) {
+        if (_capacity == 0) {
+            return;
+        }
+
+        auto k = key(path);
+        auto it = _index.find(k);
+        if (it != _index.end()) {
+            erase(it->second);
+        }
+        if (_entries.size() == _capacity) {
+            erase(std::prev(_entries.end()));
+        }
+
+        detail::h5i_inc_ref(hid);
+        _entries.push_front(Entry{std::move(k), type, hid});
+        _index.emplace(_entries.front().path, _entries.begin());
+    }
+
+    /// \brief Drop `path` and everything below it.
+    void invalidate(const std::string& path) {
+        auto k = key(path);
+        if (k.empty()) {
+            clear();
+            return;
+        }
+
+        for (auto it = _entries.begin(); it != _entries.end();) {
+            const auto& p = it->path;
+            bool is_below = p.compare(0, k.size(), k) == 0 &&
+                            (p.size() == k.size() || p[k.size()] == '/');
+            it = is_below ? erase(it) : std::next(it);
+        }
+    }
+
+    /// \brief Drop all cached objects.
+    void clear() noexcept {
+        for (const auto& entry: _entries) {
+            detail::nothrow::h5i_dec_ref(entry.hid);
+        }
+        _entries.clear();
+        _index.clear();
+    }
+
+    size_t size() const noexcept {
+        return _entries.size();
+    }
+
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    size_t getHits() const noexcept {
+        return _n_hits;
+    }
+
+    size_t getMisses() const noexcept {
+        return _n_misses;
+    }
+
+  private:
+    struct Entry {
+        std::string path;
+        ObjectType type;
+        hid_t hid;
+    };
+
+    static std::string key(const std::string& path) {
+        auto pos = path.find_first_not_of('/');
+        return pos == std::string::npos ? std::string() : path.substr(pos);
+    }
+
+    std::list<Entry>::iterator erase(std::list<Entry>::iterator entry) {
+        _index.erase(entry->path);
+        detail::nothrow::h5i_dec_ref(entry->hid);
+        return _entries.erase(entry);
+    }
+
+    size_t _capacity;
+    size_t _n_hits = 0;
+    size_t _n_misses = 0;
+    std::list<Entry> _entries;
+    std::unordered_map<std::string, std::list<Entry>::iterator> _index;
+};
+
+// The handle cache of `File`; only files have one.
+struct HandleCacheAccess {
+    template <class Derivate>
+    static HandleCache* get(const Derivate& /* node */) noexcept {
+        return nullptr;
+    }
+
+    static HandleCache* get(const File& file) noexcept;
+};
+
+}  // namespace details
+}  // namespace HighFive
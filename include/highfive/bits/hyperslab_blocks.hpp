@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "h5s_wrapper.hpp"
+#include "../H5DataSpace.hpp"
+#include "../H5Exception.hpp"
+
+namespace HighFive {
+namespace details {
+
+// The disjoint blocks of a hyperslab selection.
+class HyperSlabBlocks {
+  public:
+    explicit HyperSlabBlocks(const DataSpace& file_space)
+        : _rank(file_space.getNumberDimensions()) {
+        auto sel_type = detail::h5s_get_select_type(file_space.getId());
+        if (sel_type == H5S_SEL_ALL) {
+            auto dims = file_space.getDimensions();
+            _lower.assign(_rank, 0);
+            _upper.assign(dims.begin(), dims.end());
+        } else if (sel_type == H5S_SEL_HYPERSLABS) {
+            auto n_blocks = static_cast<size_t>(
+                detail::h5s_get_select_hyper_nblocks(file_space.getId()));
+            auto corners = std::vector<hsize_t>(2 * _rank * n_blocks);
+            detail::h5s_get_select_hyper_blocklist(file_space.getId(),
+                                                   0,
+                                                   n_blocks,
+                                                   corners.data());
+
+            for (size_t b = 0; b < n_blocks; ++b) {
+                const auto* start = corners.data() + 2 * _rank * b;
+                const auto* end = start + _rank;
+                for (size_t k = 0; k < _rank; ++k) {
+                    _lower.push_back(static_cast<size_t>(start[k]));
+                    _upper.push_back(static_cast<size_t>(end[k]) + 1);
+                }
+            }
+        } else if (sel_type != H5S_SEL_NONE) {
+            throw DataSpaceException(
+                "Only hyperslab selections can be read chunk by chunk, not point selections.");
+        }
+
+        buildIndex();
+    }
+
+    // The single block starting at `offset` with `count` elements per axis.
+    HyperSlabBlocks(const std::vector<size_t>& offset, const std::vector<size_t>& count)
+        : _rank(offset.size())
+        , _lower(offset) {
+        for (size_t k = 0; k < _rank; ++k) {
+            _upper.push_back(offset[k] + count[k]);
+        }
+        buildIndex();
+    }
+
+    size_t size() const noexcept {
+        return _rank == 0 ? 0 : _lower.size() / _rank;
+    }
+
+    // Inclusive lower and exclusive upper corner of the `b`-th block.
+    const size_t* getLower(size_t b) const {
+        return _lower.data() + b * _rank;
+    }
+
+    const size_t* getUpper(size_t b) const {
+        return _upper.data() + b * _rank;
+    }
+
+    // Number of selected elements that precede the selected `point` in
+    // row-major order.
+    size_t countPreceding(const std::vector<size_t>& point) const {
+        size_t count = 0;
+        size_t node_id = 0;
+        for (size_t k = 0; k < _rank; ++k) {
+            const auto& node = _nodes[node_id];
+            auto band = static_cast<size_t>(
+                std::upper_bound(node.bounds.begin(), node.bounds.end(), point[k]) -
+                node.bounds.begin() - 1);
+
+            count += node.offsets[band] + (point[k] - node.bounds[band]) * node.sizes[band];
+            node_id = node.children[band];
+        }
+        return count;
+    }
+
+  private:
+    // Along axis `k`, the selection is cut into bands, between consecutive
+    // lower or upper corners of the blocks. Within a band, every slice
+    // orthogonal to axis `k` selects the same elements; these are indexed by
+    // the child of the band, along axis `k + 1`.
+    struct Node {
+        std::vector<size_t> bounds;
+        // Number of selected elements before the band.
+        std::vector<size_t> offsets;
+        // Number of selected elements per slice of the band.
+        std::vector<size_t> sizes;
+        std::vector<size_t> children;
+    };
+
+    void buildIndex() {
+        if (size() != 0) {
+            auto block_ids = std::vector<size_t>(size());
+            for (size_t b = 0; b < block_ids.size(); ++b) {
+                block_ids[b] = b;
+            }
+            buildNode(block_ids, 0);
+        }
+    }
+
+    // Returns the number of elements selected by `block_ids`.
+    size_t buildNode(std::vector<size_t>& block_ids, size_t k) {
+        auto node_id = _nodes.size();
+        _nodes.emplace_back();
+
+        std::sort(block_ids.begin(), block_ids.end(), [this, k](size_t a, size_t b) {
+            return getLower(a)[k] < getLower(b)[k];
+        });
+
+        auto bounds = std::vector<size_t>{};
+        for (auto b: block_ids) {
+            bounds.push_back(getLower(b)[k]);
+            bounds.push_back(getUpper(b)[k]);
+        }
+        std::sort(bounds.begin(), bounds.end());
+        bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+        // Sweep over the bands, keeping the blocks that intersect the band.
+        auto offsets = std::vector<size_t>{};
+        auto sizes = std::vector<size_t>{};
+        auto children = std::vector<size_t>{};
+        auto active = std::vector<size_t>{};
+        size_t next = 0;
+        size_t count = 0;
+        for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+            active.erase(std::remove_if(active.begin(),
+                                        active.end(),
+                                        [this, k, &bounds, i](size_t b) {
+                                            return getUpper(b)[k] <= bounds[i];
+                                        }),
+                         active.end());
+            while (next < block_ids.size() && getLower(block_ids[next])[k] == bounds[i]) {
+                active.push_back(block_ids[next]);
+                ++next;
+            }
+
+            size_t slice_size = 0;
+            size_t child = 0;
+            if (!active.empty()) {
+                if (k + 1 == _rank) {
+                    // The blocks are disjoint, at most one covers the band.
+                    slice_size = 1;
+                } else {
+                    child = _nodes.size();
+                    auto child_ids = active;
+                    slice_size = buildNode(child_ids, k + 1);
+                }
+            }
+
+            offsets.push_back(count);
+            sizes.push_back(slice_size);
+            children.push_back(child);
+            count += (bounds[i + 1] - bounds[i]) * slice_size;
+        }
+
+        auto& node = _nodes[node_id];
+        node.bounds = std::move(bounds);
+        node.offsets = std::move(offsets);
+        node.sizes = std::move(sizes);
+        node.children = std::move(children);
+        return count;
+    }
+
+    size_t _rank;
+    std::vector<size_t> _lower;
+    std::vector<size_t> _upper;
+    std::vector<Node> _nodes;
+};
+
+}  // namespace details
+}  // namespace HighFive
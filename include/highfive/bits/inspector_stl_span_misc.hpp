@@ -51,7 +51,7 @@ struct inspector_stl_span {
         return sizes;
     }
 
-    static void prepare(type& val, const std::vector<size_t>& expected_dims) {
+    static void prepare(type& val, dims_view expected_dims) {
         auto actual_dims = getDimensions(val);
         if (actual_dims.size() != expected_dims.size()) {
             throw DataSpaceException("Mismatching rank.");
@@ -73,9 +73,9 @@ struct inspector_stl_span {
     }
 
     template <class It>
-    static void serialize(const type& val, const std::vector<size_t>& dims, It m) {
+    static void serialize(const type& val, dims_view dims, It m) {
         if (!val.empty()) {
-            auto subdims = std::vector<size_t>(dims.begin() + ndim, dims.end());
+            auto subdims = dims.drop_front(ndim);
             size_t subsize = compute_total_size(subdims);
             for (const auto& e: val) {
                 inspector<value_type>::serialize(e, subdims, m);
@@ -85,8 +85,8 @@ struct inspector_stl_span {
     }
 
     template <class It>
-    static void unserialize(const It& vec_align, const std::vector<size_t>& dims, type& val) {
-        std::vector<size_t> subdims(dims.begin() + ndim, dims.end());
+    static void unserialize(const It& vec_align, dims_view dims, type& val) {
+        auto subdims = dims.drop_front(ndim);
         size_t subsize = compute_total_size(subdims);
         for (size_t i = 0; i < dims[0]; ++i) {
             inspector<value_type>::unserialize(vec_align + i * subsize, subdims, val[i]);
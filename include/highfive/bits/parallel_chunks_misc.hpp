@@ -0,0 +1,406 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "H5Converter_misc.hpp"
+#include "H5Inspector_misc.hpp"
+#include "H5ReadWrite_misc.hpp"
+#include "compute_total_size.hpp"
+#include "datatype_cache.hpp"
+#include "h5p_wrapper.hpp"
+#include "h5s_wrapper.hpp"
+#include "hyperslab_blocks.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+inline ParallelChunkBase::ParallelChunkBase(const DataSet& dataset, size_t n_threads)
+    : _dataset(dataset)
+    , _chunks(dataset)
+    , _dims(dataset.getDimensions())
+    , _element_size(dataset.getDataType().getSize())
+    , _fill_value(_element_size, 0)
+    , _pipeline(dataset.getCreatePropertyList(), _element_size, dataset.getPath())
+    , _pool(new ThreadPool(n_threads)) {
+    auto create_props = dataset.getCreatePropertyList();
+
+    H5D_fill_value_t status;
+    detail::h5p_fill_value_defined(create_props.getId(), &status);
+    if (status != H5D_FILL_VALUE_UNDEFINED) {
+        detail::h5p_get_fill_value(create_props.getId(),
+                                   dataset.getDataType().getId(),
+                                   _fill_value.data());
+    }
+}
+
+inline size_t ParallelChunkBase::getNumberThreads() const noexcept {
+    return _pool->size();
+}
+
+inline void ParallelChunkBase::checkDataType(const DataType& mem_datatype,
+                                             const std::string& operation) const {
+    auto file_datatype = _dataset.getDataType();
+    if (file_datatype.isVariableStr() || file_datatype.isReference() ||
+        file_datatype.getClass() == DataTypeClass::VarLen) {
+        throw DataTypeException("Unable to " + operation + " the chunks of '" +
+                                _dataset.getPath() +
+                                "' directly: variable length types aren't supported.");
+    }
+
+    if (mem_datatype != file_datatype) {
+        throw DataTypeException("Unable to " + operation + " the chunks of '" +
+                                _dataset.getPath() + "' directly: the datatype in memory '" +
+                                mem_datatype.string() +
+                                "' differs from the datatype of the dataset '" +
+                                file_datatype.string() + "'.");
+    }
+}
+
+inline size_t ParallelChunkBase::getChunkBytes() const {
+    return compute_total_size(_chunks.getChunkDimensions()) * _element_size;
+}
+
+// Copies the selected elements of an unfiltered chunk to their position in
+// `buffer`, which holds all elements of the selection.
+inline void scatter_chunk(const uint8_t* chunk,
+                          const std::vector<size_t>& chunk_offset,
+                          const std::vector<size_t>& chunk_dims,
+                          size_t element_size,
+                          const HyperSlabBlocks& blocks,
+                          const std::vector<size_t>& block_ids,
+                          uint8_t* buffer) {
+    auto rank = chunk_dims.size();
+    auto lower = std::vector<size_t>(rank);
+    auto upper = std::vector<size_t>(rank);
+    auto point = std::vector<size_t>(rank);
+
+    for (auto b: block_ids) {
+        for (size_t k = 0; k < rank; ++k) {
+            lower[k] = std::max(blocks.getLower(b)[k], chunk_offset[k]);
+            upper[k] = std::min(blocks.getUpper(b)[k], chunk_offset[k] + chunk_dims[k]);
+        }
+
+        // Within a block, the elements of a row are consecutive in the selection.
+        auto row_bytes = (upper[rank - 1] - lower[rank - 1]) * element_size;
+        point = lower;
+
+        while (true) {
+            size_t src = 0;
+            for (size_t k = 0; k < rank; ++k) {
+                src = src * chunk_dims[k] + point[k] - chunk_offset[k];
+            }
+
+            auto dst = blocks.countPreceding(point);
+            std::memcpy(buffer + dst * element_size, chunk + src * element_size, row_bytes);
+
+            size_t k = rank - 1;
+            for (; k > 0; --k) {
+                if (++point[k - 1] < upper[k - 1]) {
+                    break;
+                }
+                point[k - 1] = lower[k - 1];
+            }
+
+            if (k == 0) {
+                break;
+            }
+        }
+    }
+}
+
+}  // namespace details
+
+inline ParallelChunkWriter::ParallelChunkWriter(const DataSet& dataset, size_t n_threads)
+    : details::ParallelChunkBase(dataset, n_threads) {}
+
+template <class T>
+inline void ParallelChunkWriter::write(const T& buffer) {
+    auto file_datatype = _dataset.getDataType();
+
+    const details::BufferInfo<T> buffer_info(
+        file_datatype,
+        [this]() -> std::string { return _dataset.getPath(); },
+        details::BufferInfo<T>::Operation::write);
+
+    if (!details::checkDimensions(_dims, buffer_info.getMinRank(), buffer_info.getMaxRank())) {
+        std::ostringstream ss;
+        ss << "Impossible to write buffer with dimensions n = " << buffer_info.getRank(buffer)
+           << " into dataset with dimensions " << details::format_vector(_dims) << ".";
+        throw DataSpaceException(ss.str());
+    }
+
+    checkDataType(buffer_info.data_type, "write");
+
+    auto w = details::data_converter::serialize<T>(buffer, _dims, file_datatype);
+    writeBytes(reinterpret_cast<const uint8_t*>(w.getPointer()));
+}
+
+template <class T>
+inline void ParallelChunkWriter::write_raw(const T* buffer) {
+    using element_type = typename details::inspector<T>::base_type;
+    checkDataType(details::DataTypeCache::getChecked<element_type>(), "write");
+
+    writeBytes(reinterpret_cast<const uint8_t*>(buffer));
+}
+
+inline void ParallelChunkWriter::writeBytes(const uint8_t* buffer) {
+    // Bounds the memory used by filtered chunks waiting to be written.
+    auto max_pending = 2 * _pool->size();
+
+    auto pending = std::deque<std::pair<size_t, std::future<std::vector<uint8_t>>>>{};
+    auto commit = [this, &pending]() {
+        auto index = pending.front().first;
+        auto chunk = pending.front().second.get();
+        pending.pop_front();
+
+        _dataset.writeChunk(_chunks.getOffset(index), chunk);
+    };
+
+    try {
+        for (size_t i = 0; i < _chunks.size(); ++i) {
+            pending.emplace_back(i, _pool->submit([this, buffer, i]() {
+                return filterChunk(buffer, i);
+            }));
+
+            if (pending.size() >= max_pending) {
+                commit();
+            }
+        }
+
+        while (!pending.empty()) {
+            commit();
+        }
+    } catch (...) {
+        // The tasks still reference `buffer`, which the caller may free.
+        for (auto& p: pending) {
+            p.second.wait();
+        }
+        throw;
+    }
+}
+
+inline std::vector<uint8_t> ParallelChunkWriter::filterChunk(const uint8_t* buffer,
+                                                             size_t chunk_index) const {
+    const auto& chunk_dims = _chunks.getChunkDimensions();
+    auto offset = _chunks.getOffset(chunk_index);
+    auto count = _chunks.getCount(chunk_index);
+
+    auto rank = _dims.size();
+    auto chunk = std::vector<uint8_t>(getChunkBytes());
+
+    // Edge chunks are padded with the fill value, as HDF5 does.
+    if (count != chunk_dims) {
+        for (size_t i = 0; i < chunk.size(); i += _element_size) {
+            std::memcpy(chunk.data() + i, _fill_value.data(), _element_size);
+        }
+    }
+
+    // Copy one row, i.e. a contiguous run along the last axis, at a time.
+    auto row_bytes = count[rank - 1] * _element_size;
+    auto n_rows = compute_total_size(count) / count[rank - 1];
+    auto index = std::vector<size_t>(rank, 0);
+
+    for (size_t row = 0; row < n_rows; ++row) {
+        size_t src = 0;
+        size_t dst = 0;
+        for (size_t k = 0; k < rank; ++k) {
+            src = src * _dims[k] + offset[k] + index[k];
+            dst = dst * chunk_dims[k] + index[k];
+        }
+
+        std::memcpy(chunk.data() + dst * _element_size, buffer + src * _element_size, row_bytes);
+
+        for (size_t k = rank - 1; k > 0; --k) {
+            if (++index[k - 1] < count[k - 1]) {
+                break;
+            }
+            index[k - 1] = 0;
+        }
+    }
+
+    auto scratch = std::vector<uint8_t>{};
+    _pipeline.encode(chunk, scratch);
+
+    return chunk;
+}
+
+inline ParallelChunkReader::ParallelChunkReader(const DataSet& dataset, size_t n_threads)
+    : details::ParallelChunkBase(dataset, n_threads) {}
+
+template <class T>
+inline void ParallelChunkReader::read(T& array) {
+    read(_dataset.getSpace(), _dataset.getMemSpace(), array);
+}
+
+template <class T>
+inline void ParallelChunkReader::read(const Selection& selection, T& array) {
+    read(selection.getSpace(), selection.getMemSpace(), array);
+}
+
+template <class T>
+inline void ParallelChunkReader::read_raw(T* array) {
+    static_assert(!std::is_const<T>::value,
+                  "read() requires a non-const structure to read data into");
+
+    using element_type = typename details::inspector<T>::base_type;
+    checkDataType(details::DataTypeCache::getChecked<element_type>(), "read");
+
+    readBytes(_dataset.getSpace(), reinterpret_cast<uint8_t*>(array));
+}
+
+template <class T>
+inline void ParallelChunkReader::read_raw(const Selection& selection, T* array) {
+    static_assert(!std::is_const<T>::value,
+                  "read() requires a non-const structure to read data into");
+
+    using element_type = typename details::inspector<T>::base_type;
+    checkDataType(details::DataTypeCache::getChecked<element_type>(), "read");
+
+    readBytes(selection.getSpace(), reinterpret_cast<uint8_t*>(array));
+}
+
+template <class T>
+inline void ParallelChunkReader::read(const DataSpace& file_space,
+                                      const DataSpace& mem_space,
+                                      T& array) {
+    auto file_datatype = _dataset.getDataType();
+
+    const details::BufferInfo<T> buffer_info(
+        file_datatype,
+        [this]() -> std::string { return _dataset.getPath(); },
+        details::BufferInfo<T>::Operation::read);
+
+    if (!details::checkDimensions(mem_space, buffer_info.getMinRank(), buffer_info.getMaxRank())) {
+        std::ostringstream ss;
+        ss << "Impossible to read DataSet of dimensions " << mem_space.getNumberDimensions()
+           << " into arrays of dimensions: " << buffer_info.getMinRank() << "(min) to "
+           << buffer_info.getMaxRank() << "(max)";
+        throw DataSpaceException(ss.str());
+    }
+
+    checkDataType(buffer_info.data_type, "read");
+
+    auto dims = mem_space.getDimensions();
+    auto r = details::data_converter::get_reader<T>(dims, array, file_datatype);
+    readBytes(file_space, reinterpret_cast<uint8_t*>(r.getPointer()));
+    r.unserialize(array);
+}
+
+inline void ParallelChunkReader::readBytes(const DataSpace& file_space, uint8_t* buffer) {
+    const auto& chunk_dims = _chunks.getChunkDimensions();
+    auto rank = _dims.size();
+    auto blocks = details::HyperSlabBlocks(file_space);
+
+    auto n_chunks = std::vector<size_t>(rank);
+    for (size_t k = 0; k < rank; ++k) {
+        n_chunks[k] = (_dims[k] + chunk_dims[k] - 1) / chunk_dims[k];
+    }
+
+    // For every chunk intersecting the selection, the blocks it intersects.
+    auto chunk_blocks = std::map<size_t, std::vector<size_t>>{};
+    auto first = std::vector<size_t>(rank);
+    auto last = std::vector<size_t>(rank);
+    auto index = std::vector<size_t>(rank);
+    for (size_t b = 0; b < blocks.size(); ++b) {
+        for (size_t k = 0; k < rank; ++k) {
+            first[k] = blocks.getLower(b)[k] / chunk_dims[k];
+            last[k] = (blocks.getUpper(b)[k] - 1) / chunk_dims[k];
+        }
+
+        index = first;
+        while (true) {
+            size_t linear_index = 0;
+            for (size_t k = 0; k < rank; ++k) {
+                linear_index = linear_index * n_chunks[k] + index[k];
+            }
+            chunk_blocks[linear_index].push_back(b);
+
+            size_t k = rank;
+            for (; k > 0; --k) {
+                if (++index[k - 1] <= last[k - 1]) {
+                    break;
+                }
+                index[k - 1] = first[k - 1];
+            }
+
+            if (k == 0) {
+                break;
+            }
+        }
+    }
+
+    auto chunk_bytes = getChunkBytes();
+    auto max_pending = 2 * _pool->size();
+    auto pending = std::deque<std::future<void>>{};
+
+    try {
+        for (const auto& kv: chunk_blocks) {
+            auto offset = _chunks.getOffset(kv.first);
+            const auto& block_ids = kv.second;
+
+            // Chunks that were never written don't have any storage.
+            auto raw = std::vector<uint8_t>{};
+#if H5_VERSION_GE(1, 10, 5)
+            raw.resize(static_cast<size_t>(_dataset.getChunkInfo(offset).size));
+#else
+            raw.resize(static_cast<size_t>(_dataset.getChunkStorageSize(offset)));
+#endif
+            bool is_allocated = !raw.empty();
+            uint32_t filter_mask = 0;
+            if (is_allocated) {
+                filter_mask = _dataset.readChunk(offset, static_cast<void*>(raw.data()));
+            }
+
+            auto task = [this,
+                         &blocks,
+                         &block_ids,
+                         &chunk_dims,
+                         buffer,
+                         chunk_bytes,
+                         offset,
+                         is_allocated,
+                         filter_mask,
+                         raw = std::move(raw)]() mutable {
+                if (is_allocated) {
+                    auto scratch = std::vector<uint8_t>{};
+                    _pipeline.decode(raw, filter_mask, chunk_bytes, scratch);
+                } else {
+                    raw.resize(chunk_bytes);
+                    for (size_t i = 0; i < chunk_bytes; i += _element_size) {
+                        std::memcpy(raw.data() + i, _fill_value.data(), _element_size);
+                    }
+                }
+
+                details::scatter_chunk(
+                    raw.data(), offset, chunk_dims, _element_size, blocks, block_ids, buffer);
+            };
+
+            pending.push_back(_pool->submit(std::move(task)));
+            if (pending.size() >= max_pending) {
+                pending.front().get();
+                pending.pop_front();
+            }
+        }
+
+        while (!pending.empty()) {
+            pending.front().get();
+            pending.pop_front();
+        }
+    } catch (...) {
+        // The tasks still reference `buffer` and `blocks`.
+        for (auto& p: pending) {
+            p.wait();
+        }
+        throw;
+    }
+}
+
+}  // namespace HighFive
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HIGHFIVE_HAS_POSIX_IO 1
+#else
+#define HIGHFIVE_HAS_POSIX_IO 0
+#endif
+
+#include "../H5Exception.hpp"
+
+namespace HighFive {
+namespace details {
+
+// Accessing the file of a dataset directly, bypassing HDF5; on POSIX systems
+// only. Elsewhere, all functions throw, or fail.
+
+// Opens `filename` read-only and returns its file descriptor.
+inline int open_read_only(const std::string& filename) {
+#if HIGHFIVE_HAS_POSIX_IO
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw FileException("Unable to open '" + filename + "': " + std::strerror(errno));
+    }
+    return fd;
+#else
+    throw FileException("Unable to open '" + filename +
+                        "' directly: POSIX I/O isn't supported on this platform.");
+#endif
+}
+
+inline bool close_file(int fd) noexcept {
+#if HIGHFIVE_HAS_POSIX_IO
+    return ::close(fd) == 0;
+#else
+    (void) fd;
+    return false;
+#endif
+}
+
+// Reads exactly `n_bytes` at `offset`; safe to call concurrently on the same
+// file descriptor.
+inline void pread_all(int fd, void* buffer, size_t n_bytes, uint64_t offset) {
+#if HIGHFIVE_HAS_POSIX_IO
+    auto* dst = static_cast<char*>(buffer);
+    while (n_bytes > 0) {
+        auto n_read = ::pread(fd, dst, n_bytes, static_cast<off_t>(offset));
+        if (n_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n_read < 0) {
+            throw FileException(std::string("Unable to read from file: ") + std::strerror(errno));
+        }
+        if (n_read == 0) {
+            throw FileException("Unable to read from file: unexpected end of file.");
+        }
+
+        dst += n_read;
+        n_bytes -= static_cast<size_t>(n_read);
+        offset += static_cast<uint64_t>(n_read);
+    }
+#else
+    (void) fd;
+    (void) buffer;
+    (void) n_bytes;
+    (void) offset;
+    throw FileException("Unable to read from file: POSIX I/O isn't supported on this platform.");
+#endif
+}
+
+struct FileMapping {
+    void* address;
+    size_t size;
+    // The first mapped byte that was requested; `address` is page-aligned.
+    const void* data;
+};
+
+// Maps `n_bytes` of the file `filename`, starting at `offset`, read-only.
+inline FileMapping map_file_range(const std::string& filename, uint64_t offset, size_t n_bytes) {
+#if HIGHFIVE_HAS_POSIX_IO
+    int fd = open_read_only(filename);
+
+    struct stat file_status;
+    if (::fstat(fd, &file_status) != 0 ||
+        static_cast<uint64_t>(file_status.st_size) < offset + n_bytes) {
+        close_file(fd);
+        throw FileException("Unable to map '" + filename + "': the file is too short.");
+    }
+
+    auto page_size = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+    auto aligned_offset = offset - offset % page_size;
+    auto size = static_cast<size_t>(offset - aligned_offset) + n_bytes;
+
+    void* address =
+        ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(aligned_offset));
+    int err = errno;
+    close_file(fd);
+
+    if (address == MAP_FAILED) {
+        throw FileException("Unable to map '" + filename + "': " + std::strerror(err));
+    }
+
+    return {address, size, static_cast<const char*>(address) + (offset - aligned_offset)};
+#else
+    (void) offset;
+    (void) n_bytes;
+    throw FileException("Unable to map '" + filename +
+                        "': memory mapping isn't supported on this platform.");
+#endif
+}
+
+inline bool unmap_file_range(void* address, size_t size) noexcept {
+#if HIGHFIVE_HAS_POSIX_IO
+    return ::munmap(address, size) == 0;
+#else
+    (void) address;
+    (void) size;
+    return false;
+#endif
+}
+
+}  // namespace details
+}  // namespace HighFive
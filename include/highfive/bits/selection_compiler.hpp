@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace HighFive {
+namespace detail {
+
+// The indices `offset + i * stride + j` for `i < count` and `j < block`, i.e.
+// the selection along one axis of a `RegularHyperSlab`.
+struct StridedBlocks {
+    size_t offset;
+    size_t count;
+    size_t stride;
+    size_t block;
+};
+
+// Compiles the indices selected along one axis into as few `StridedBlocks`
+// as possible. Indices are added as half-open ranges, sorted and without
+// overlap; adjacent ranges are merged into runs, and runs of equal length
+// at regular distances into a single `StridedBlocks`.
+//
+// Selecting 5000 rows one-by-one would otherwise require one hyperslab per
+// row; a regular pattern, e.g. every other row, now requires one in total.
+class AxisSelection {
+  public:
+    void add(size_t begin, size_t end) {
+        if (begin >= end) {
+            return;
+        }
+
+        if (!_runs.empty() && _runs.back()[1] == begin) {
+            _runs.back()[1] = end;
+        } else {
+            _runs.push_back({begin, end});
+        }
+    }
+
+    void add(size_t index) {
+        add(index, index + 1);
+    }
+
+    // Greedily extends the current group by the next run, if it has the same
+    // length and continues the stride.
+    std::vector<StridedBlocks> compile() const {
+        auto groups = std::vector<StridedBlocks>{};
+        for (const auto& run: _runs) {
+            auto length = run[1] - run[0];
+            if (!groups.empty()) {
+                auto& group = groups.back();
+                auto last = group.offset + (group.count - 1) * group.stride;
+
+                if (group.block == length && run[0] >= last + length) {
+                    if (group.count == 1) {
+                        group.stride = run[0] - group.offset;
+                        group.count = 2;
+                        continue;
+                    }
+                    if (run[0] - last == group.stride) {
+                        group.count += 1;
+                        continue;
+                    }
+                }
+            }
+
+            groups.push_back({run[0], 1, 1, length});
+        }
+
+        return groups;
+    }
+
+  private:
+    std::vector<std::array<size_t, 2>> _runs;
+};
+
+}  // namespace detail
+}  // namespace HighFive
@@ -0,0 +1,366 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+#include "H5Inspector_misc.hpp"
+#include "h5d_wrapper.hpp"
+#include "h5s_wrapper.hpp"
+#include "compute_total_size.hpp"
+#include "../H5DataSpace.hpp"
+#include "../H5DataType.hpp"
+#include "../H5PropertyList.hpp"
+#include "../H5TransferBuffer.hpp"
+
+namespace HighFive {
+namespace details {
+
+template <class T, class = void>
+struct has_strided_layout: std::false_type {};
+
+template <class T>
+struct has_strided_layout<T, typename std::enable_if<inspector<T>::is_strided>::type>
+    : std::true_type {};
+
+///
+/// \brief Upper bound, in bytes, of the staging buffer for transposed layouts.
+///
+/// Layouts that can't be described by a memory hyperslab are transferred in
+/// blocks of rows of the file selection. Each block is staged in a
+/// `TransferBuffer` of at most (roughly) this size.
+constexpr size_t strided_staging_bytes = size_t(8) << 20;
+
+///
+/// \brief The memory layout of a strided object.
+///
+/// The object consists of `compute_total_size(dims)` elements, the element
+/// with multi-index `i` is located at `sum(i[k] * strides[k])`, relative to
+/// the first element. Both are measured in number of elements. Axes of length
+/// one don't affect the layout and are dropped.
+class StridedLayout {
+  public:
+    StridedLayout(const std::vector<size_t>& dims, const std::vector<size_t>& strides) {
+        for (size_t k = 0; k < dims.size(); ++k) {
+            if (dims[k] != 1) {
+                _dims.push_back(dims[k]);
+                _strides.push_back(strides[k]);
+            }
+        }
+    }
+
+    /// \brief Is every element at a distinct location?
+    bool isInjective() const {
+        return std::find(_strides.begin(), _strides.end(), size_t(0)) == _strides.end();
+    }
+
+    ///
+    /// \brief Can the layout be described by a hyperslab of a row-major array?
+    ///
+    /// This is the case if the strides decrease along the axes and every axis
+    /// fits into the stride of the previous one, e.g. row-major arrays with a
+    /// padded leading dimension.
+    bool isHyperSlab() const {
+        if (!isInjective()) {
+            return false;
+        }
+
+        for (size_t k = 1; k < _strides.size(); ++k) {
+            if (_strides[k - 1] % _strides[k] != 0 ||
+                _strides[k - 1] / _strides[k] < _dims[k]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    ///
+    /// \brief The memory space selecting exactly the elements of the object.
+    ///
+    /// The extent of the memory space covers a region that starts at the first
+    /// element of the object. Only the selected elements are accessed by HDF5.
+    /// Requires `isHyperSlab()`.
+    DataSpace getMemSpace() const {
+        auto rank = _dims.size();
+        if (rank == 0) {
+            return DataSpace(std::vector<size_t>{1});
+        }
+
+        std::vector<size_t> extent(rank);
+        extent[0] = _dims[0];
+        for (size_t k = 1; k < rank; ++k) {
+            extent[k] = _strides[k - 1] / _strides[k];
+        }
+
+        std::vector<hsize_t> count(_dims.begin(), _dims.end());
+        if (_strides.back() != 1) {
+            extent.push_back(_strides.back());
+            count.push_back(1);
+        }
+
+        auto mem_space = DataSpace(extent);
+        std::vector<hsize_t> start(count.size(), 0);
+        detail::h5s_select_hyperslab(mem_space.getId(),
+                                     H5S_SELECT_SET,
+                                     start.data(),
+                                     nullptr,
+                                     count.data(),
+                                     nullptr);
+        return mem_space;
+    }
+
+    ///
+    /// \brief Call `f(offset)` for the elements `begin, ..., begin + n - 1`.
+    ///
+    /// Elements are numbered in row-major order; `offset` is the location of
+    /// the element relative to the first element.
+    template <class F>
+    void forEachOffset(size_t begin, size_t n, F f) const {
+        auto rank = _dims.size();
+        std::vector<size_t> index(rank);
+        size_t offset = 0;
+        for (size_t k = rank; k > 0; --k) {
+            index[k - 1] = begin % _dims[k - 1];
+            begin /= _dims[k - 1];
+            offset += index[k - 1] * _strides[k - 1];
+        }
+
+        for (size_t i = 0; i < n; ++i) {
+            f(offset);
+            for (size_t k = rank; k > 0; --k) {
+                offset += _strides[k - 1];
+                if (++index[k - 1] < _dims[k - 1]) {
+                    break;
+                }
+                offset -= index[k - 1] * _strides[k - 1];
+                index[k - 1] = 0;
+            }
+        }
+    }
+
+  private:
+    std::vector<size_t> _dims;
+    std::vector<size_t> _strides;
+};
+
+///
+/// \brief Split the selection of `file_space` into blocks of consecutive rows.
+///
+/// Calls `f(block_space, begin, n)` for every block, where `block_space`
+/// selects the elements `begin, ..., begin + n - 1` of the selection of
+/// `file_space`. Blocks have at most `max_elements` elements, unless a single
+/// row is larger than that.
+///
+/// Only selections of all elements and regular hyperslabs can be split. For
+/// any other selection, `false` is returned without calling `f`.
+template <class F>
+inline bool for_each_file_block(const DataSpace& file_space, size_t max_elements, F f) {
+    auto n_elements = static_cast<size_t>(detail::h5s_get_select_npoints(file_space.getId()));
+    if (n_elements <= max_elements) {
+        f(file_space, size_t(0), n_elements);
+        return true;
+    }
+
+    auto rank = file_space.getNumberDimensions();
+    if (rank == 0) {
+        return false;
+    }
+
+    std::vector<hsize_t> start(rank, 0);
+    std::vector<hsize_t> stride(rank, 1);
+    std::vector<hsize_t> count(rank, 1);
+    std::vector<hsize_t> block(rank, 1);
+
+    auto sel_type = detail::h5s_get_select_type(file_space.getId());
+    if (sel_type == H5S_SEL_ALL) {
+        auto dims = file_space.getDimensions();
+        std::copy(dims.begin(), dims.end(), count.begin());
+#if H5_VERSION_GE(1, 10, 0)
+    } else if (sel_type == H5S_SEL_HYPERSLABS &&
+               detail::h5s_is_regular_hyperslab(file_space.getId()) > 0) {
+        detail::h5s_get_regular_hyperslab(
+            file_space.getId(), start.data(), stride.data(), count.data(), block.data());
+#endif
+    } else {
+        return false;
+    }
+
+    size_t row_size = 1;
+    for (size_t k = 1; k < rank; ++k) {
+        row_size *= count[k] * block[k];
+    }
+
+    auto n_rows = static_cast<size_t>(count[0] * block[0]);
+    if (n_rows * row_size != n_elements) {
+        return false;
+    }
+
+    // If there's more than one block along the first axis, blocks of the
+    // hyperslab can't be split.
+    auto unit = count[0] > 1 ? static_cast<size_t>(block[0]) : size_t(1);
+    auto rows_per_step = std::max(unit, max_elements / row_size / unit * unit);
+
+    for (size_t row = 0; row < n_rows; row += rows_per_step) {
+        auto n = std::min(rows_per_step, n_rows - row);
+        auto block_start = start;
+        auto block_count = count;
+        auto block_block = block;
+        if (count[0] > 1) {
+            block_start[0] += (row / unit) * stride[0];
+            block_count[0] = n / unit;
+        } else {
+            block_start[0] += row;
+            block_block[0] = n;
+        }
+
+        auto block_space = file_space.clone();
+        detail::h5s_select_hyperslab(block_space.getId(),
+                                     H5S_SELECT_SET,
+                                     block_start.data(),
+                                     stride.data(),
+                                     block_count.data(),
+                                     block_block.data());
+
+        f(block_space, row * row_size, n * row_size);
+    }
+
+    return true;
+}
+
+template <class T>
+inline typename std::enable_if<!has_strided_layout<T>::value, bool>::type read_strided(
+    hid_t /* dataset_id */,
+    const DataSpace& /* file_space */,
+    const std::vector<size_t>& /* dims */,
+    T& /* array */,
+    const DataType& /* mem_datatype */,
+    const DataTransferProps& /* xfer_props */,
+    TransferBuffer& /* transfer_buffer */) {
+    return false;
+}
+
+///
+/// \brief Read directly into the strided object `array`.
+///
+/// If the layout of `array` is a hyperslab, HDF5 scatters the elements
+/// directly into `array`. Otherwise, blocks of rows are read into a bounded
+/// staging buffer. Returns `false` if neither is possible.
+template <class T>
+inline typename std::enable_if<has_strided_layout<T>::value, bool>::type read_strided(
+    hid_t dataset_id,
+    const DataSpace& file_space,
+    const std::vector<size_t>& dims,
+    T& array,
+    const DataType& mem_datatype,
+    const DataTransferProps& xfer_props,
+    TransferBuffer& transfer_buffer) {
+    using hdf5_type = typename inspector<T>::hdf5_type;
+
+    auto n_elements = compute_total_size(dims);
+    if (n_elements == 0) {
+        return false;
+    }
+
+    inspector<T>::prepare(array, dims);
+    if (compute_total_size(inspector<T>::getDimensions(array)) != n_elements) {
+        return false;
+    }
+
+    auto layout = StridedLayout(inspector<T>::getDimensions(array),
+                                inspector<T>::getStrides(array));
+    if (!layout.isInjective()) {
+        return false;
+    }
+
+    hdf5_type* ptr = inspector<T>::data(array);
+    if (layout.isHyperSlab()) {
+        detail::h5d_read(dataset_id,
+                         mem_datatype.getId(),
+                         layout.getMemSpace().getId(),
+                         file_space.getId(),
+                         xfer_props.getId(),
+                         static_cast<void*>(ptr));
+        return true;
+    }
+
+    auto max_elements = std::max(size_t(1), strided_staging_bytes / sizeof(hdf5_type));
+    return for_each_file_block(
+        file_space, max_elements, [&](const DataSpace& block_space, size_t begin, size_t n) {
+            auto staging = TransferBufferAccess::allocate<hdf5_type>(transfer_buffer, n);
+            detail::h5d_read(dataset_id,
+                             mem_datatype.getId(),
+                             DataSpace(std::vector<size_t>{n}).getId(),
+                             block_space.getId(),
+                             xfer_props.getId(),
+                             static_cast<void*>(staging));
+
+            auto it = staging;
+            layout.forEachOffset(begin, n, [&](size_t offset) { ptr[offset] = *(it++); });
+        });
+}
+
+template <class T>
+inline typename std::enable_if<!has_strided_layout<T>::value, bool>::type write_strided(
+    hid_t /* dataset_id */,
+    const DataSpace& /* file_space */,
+    const std::vector<size_t>& /* dims */,
+    const T& /* buffer */,
+    const DataType& /* mem_datatype */,
+    const DataTransferProps& /* xfer_props */,
+    TransferBuffer& /* transfer_buffer */) {
+    return false;
+}
+
+///
+/// \brief Write directly from the strided object `buffer`.
+///
+/// Counterpart of `read_strided`, HDF5 gathers the elements directly from
+/// `buffer`, or blocks of rows are staged in a bounded buffer. Returns `false`
+/// if neither is possible.
+template <class T>
+inline typename std::enable_if<has_strided_layout<T>::value, bool>::type write_strided(
+    hid_t dataset_id,
+    const DataSpace& file_space,
+    const std::vector<size_t>& dims,
+    const T& buffer,
+    const DataType& mem_datatype,
+    const DataTransferProps& xfer_props,
+    TransferBuffer& transfer_buffer) {
+    using hdf5_type = typename inspector<T>::hdf5_type;
+
+    auto n_elements = compute_total_size(dims);
+    auto buffer_dims = inspector<T>::getDimensions(buffer);
+    if (n_elements == 0 || compute_total_size(buffer_dims) != n_elements) {
+        return false;
+    }
+
+    auto layout = StridedLayout(buffer_dims, inspector<T>::getStrides(buffer));
+    const hdf5_type* ptr = inspector<T>::data(buffer);
+    if (layout.isHyperSlab()) {
+        detail::h5d_write(dataset_id,
+                          mem_datatype.getId(),
+                          layout.getMemSpace().getId(),
+                          file_space.getId(),
+                          xfer_props.getId(),
+                          static_cast<const void*>(ptr));
+        return true;
+    }
+
+    auto max_elements = std::max(size_t(1), strided_staging_bytes / sizeof(hdf5_type));
+    return for_each_file_block(
+        file_space, max_elements, [&](const DataSpace& block_space, size_t begin, size_t n) {
+            auto staging = TransferBufferAccess::allocate<hdf5_type>(transfer_buffer, n);
+            auto it = staging;
+            layout.forEachOffset(begin, n, [&](size_t offset) { *(it++) = ptr[offset]; });
+
+            detail::h5d_write(dataset_id,
+                              mem_datatype.getId(),
+                              DataSpace(std::vector<size_t>{n}).getId(),
+                              block_space.getId(),
+                              xfer_props.getId(),
+                              static_cast<const void*>(staging));
+        });
+}
+
+}  // namespace details
+}  // namespace HighFive
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace HighFive {
+namespace details {
+
+// The bounds of the size of the blocks of a `StringArena`.
+const size_t string_arena_min_block_size = size_t(4) << 10;
+const size_t string_arena_max_block_size = size_t(64) << 20;
+
+// A bump allocator for the variable-length strings HDF5 allocates while
+// reading, see `H5Pset_vlen_mem_manager`. Memory is only released when the
+// arena is destroyed; `deallocate` does nothing.
+class StringArena {
+  public:
+    // The first block has `block_size` bytes, within the bounds of the
+    // later ones.
+    explicit StringArena(size_t block_size)
+        : _block_size(std::min(std::max(block_size, string_arena_min_block_size),
+                               string_arena_max_block_size)) {}
+
+    StringArena(const StringArena&) = delete;
+    StringArena& operator=(const StringArena&) = delete;
+
+    // Returns `nullptr` if out of memory; which HDF5 reports as an error.
+    void* allocate(size_t n_bytes) noexcept {
+        if (n_bytes > _remaining) {
+            auto block_size = std::max(_block_size, n_bytes);
+            auto block = std::unique_ptr<char[]>(new (std::nothrow) char[block_size]);
+            if (block == nullptr) {
+                return nullptr;
+            }
+
+            try {
+                _blocks.push_back(std::move(block));
+            } catch (...) {
+                // `block` still owns, and frees, the memory.
+                return nullptr;
+            }
+            _next = _blocks.back().get();
+            _remaining = block_size;
+            // Grow geometrically, but don't waste more than the maximum.
+            _block_size = std::min(2 * _block_size, string_arena_max_block_size);
+        }
+
+        auto* ptr = _next;
+        _next += n_bytes;
+        _remaining -= n_bytes;
+        return ptr;
+    }
+
+    // The callbacks passed to `H5Pset_vlen_mem_manager`; `info` is the arena.
+    static void* allocate(size_t n_bytes, void* info) noexcept {
+        return static_cast<StringArena*>(info)->allocate(n_bytes);
+    }
+
+    static void deallocate(void* /* ptr */, void* /* info */) noexcept {}
+
+  private:
+    std::vector<std::unique_ptr<char[]>> _blocks;
+    char* _next = nullptr;
+    size_t _remaining = 0;
+    size_t _block_size;
+};
+
+}  // namespace details
+}  // namespace HighFive
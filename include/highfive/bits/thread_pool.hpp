@@ -0,0 +1,100 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace HighFive {
+namespace details {
+
+///
+/// \brief A fixed number of worker threads processing tasks in FIFO order.
+///
+/// The pool never calls into HDF5 itself; it's used to run CPU-bound work,
+/// e.g. compressing chunks, next to the thread that owns the HDF5 calls.
+/// Exceptions thrown by a task are propagated through its `std::future`.
+class ThreadPool {
+  public:
+    ///
+    /// \brief Start `n_threads` workers; `0` means one per hardware thread.
+    explicit ThreadPool(size_t n_threads) {
+        if (n_threads == 0) {
+            n_threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        _threads.reserve(n_threads);
+        for (size_t i = 0; i < n_threads; ++i) {
+            _threads.emplace_back([this]() { work(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_all();
+
+        for (auto& thread: _threads) {
+            thread.join();
+        }
+    }
+
+    size_t size() const noexcept {
+        return _threads.size();
+    }
+
+    template <class F>
+    std::future<decltype(std::declval<F&>()())> submit(F&& f) {
+        using result_type = decltype(std::declval<F&>()());
+
+        auto task = std::make_shared<std::packaged_task<result_type()>>(std::forward<F>(f));
+        auto future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks.emplace_back([task]() { (*task)(); });
+        }
+        _cv.notify_one();
+
+        return future;
+    }
+
+  private:
+    void work() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _cv.wait(lock, [this]() { return _stop || !_tasks.empty(); });
+                if (_tasks.empty()) {
+                    return;
+                }
+
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+            }
+
+            task();
+        }
+    }
+
+    std::vector<std::thread> _threads;
+    std::deque<std::function<void()>> _tasks;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _stop = false;
+};
+
+}  // namespace details
+}  // namespace HighFive
@@ -44,7 +44,7 @@ struct inspector<boost::multi_array<T, Dims>> {
         return sizes;
     }
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
+    static void prepare(type& val, dims_view dims) {
         if (dims.size() < ndim) {
             std::ostringstream os;
             os << "Only '" << dims.size() << "' given but boost::multi_array is of size '" << ndim
@@ -54,7 +54,7 @@ struct inspector<boost::multi_array<T, Dims>> {
         boost::array<typename type::index, Dims> ext;
         std::copy(dims.begin(), dims.begin() + ndim, ext.begin());
         val.resize(ext);
-        std::vector<size_t> next_dims(dims.begin() + Dims, dims.end());
+        auto next_dims = dims.drop_front(Dims);
         std::size_t size = std::accumulate(dims.begin(),
                                            dims.begin() + Dims,
                                            std::size_t{1},
@@ -81,10 +81,10 @@ struct inspector<boost::multi_array<T, Dims>> {
     }
 
     template <class It>
-    static void serialize(const type& val, const std::vector<size_t>& dims, It m) {
+    static void serialize(const type& val, dims_view dims, It m) {
         assert_c_order(val);
         size_t size = val.num_elements();
-        auto subdims = std::vector<size_t>(dims.begin() + ndim, dims.end());
+        auto subdims = dims.drop_front(ndim);
         size_t subsize = compute_total_size(subdims);
         for (size_t i = 0; i < size; ++i) {
             inspector<value_type>::serialize(*(val.origin() + i), subdims, m + i * subsize);
@@ -92,9 +92,9 @@ struct inspector<boost::multi_array<T, Dims>> {
     }
 
     template <class It>
-    static void unserialize(It vec_align, const std::vector<size_t>& dims, type& val) {
+    static void unserialize(It vec_align, dims_view dims, type& val) {
         assert_c_order(val);
-        std::vector<size_t> next_dims(dims.begin() + ndim, dims.end());
+        auto next_dims = dims.drop_front(ndim);
         size_t subsize = compute_total_size(next_dims);
         for (size_t i = 0; i < val.num_elements(); ++i) {
             inspector<value_type>::unserialize(vec_align + i * subsize,
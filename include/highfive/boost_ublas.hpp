@@ -34,7 +34,7 @@ struct inspector<boost::numeric::ublas::matrix<T>> {
         return sizes;
     }
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
+    static void prepare(type& val, dims_view dims) {
         if (dims.size() < ndim) {
             std::ostringstream os;
             os << "Impossible to pair DataSet with " << dims.size() << " dimensions into a " << ndim
@@ -52,19 +52,17 @@ struct inspector<boost::numeric::ublas::matrix<T>> {
         return inspector<value_type>::data(val(0, 0));
     }
 
-    static void serialize(const type& val, const std::vector<size_t>& dims, hdf5_type* m) {
+    static void serialize(const type& val, dims_view dims, hdf5_type* m) {
         size_t size = val.size1() * val.size2();
-        auto subdims = std::vector<size_t>(dims.begin() + ndim, dims.end());
+        auto subdims = dims.drop_front(ndim);
         size_t subsize = compute_total_size(subdims);
         for (size_t i = 0; i < size; ++i) {
             inspector<value_type>::serialize(*(&val(0, 0) + i), subdims, m + i * subsize);
         }
     }
 
-    static void unserialize(const hdf5_type* vec_align,
-                            const std::vector<size_t>& dims,
-                            type& val) {
-        std::vector<size_t> next_dims(dims.begin() + ndim, dims.end());
+    static void unserialize(const hdf5_type* vec_align, dims_view dims, type& val) {
+        auto next_dims = dims.drop_front(ndim);
         size_t subsize = compute_total_size(next_dims);
         size_t size = val.size1() * val.size2();
         for (size_t i = 0; i < size; ++i) {
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5DataType.hpp"
+#include "H5Selection.hpp"
+#include "bits/hyperslab_blocks.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// The part of `DirectReader` that doesn't depend on the element type.
+class DirectReaderBase {
+  public:
+    DirectReaderBase(const DirectReaderBase&) = delete;
+    DirectReaderBase& operator=(const DirectReaderBase&) = delete;
+
+    DirectReaderBase(DirectReaderBase&& other) noexcept;
+    DirectReaderBase& operator=(DirectReaderBase&& other) noexcept;
+
+    ///
+    /// \brief Closes the file descriptor; errors are logged.
+    ~DirectReaderBase();
+
+    ///
+    /// \brief The dimensions of the dataset, when the reader was created.
+    const std::vector<size_t>& getDimensions() const noexcept {
+        return _dims;
+    }
+
+  protected:
+    DirectReaderBase(const DataSet& dataset, const DataType& mem_datatype);
+
+    // Reads the elements of `blocks`, in row-major order; no HDF5 calls.
+    void readBytes(const HyperSlabBlocks& blocks, uint8_t* buffer) const;
+
+    // Throws unless the block is inside the dataset.
+    void checkBlock(const std::vector<size_t>& offset, const std::vector<size_t>& count) const;
+
+    // Fills `n_bytes` of `buffer` with the fill value.
+    void fill(uint8_t* buffer, size_t n_bytes) const noexcept;
+
+    std::string _path;
+    DataType _datatype;
+    std::vector<size_t> _dims;
+    size_t _element_size;
+    std::vector<uint8_t> _fill_value;
+
+    // A contiguous dataset is a single chunk, spanning the entire dataset.
+    std::vector<size_t> _chunk_dims;
+    std::vector<size_t> _n_chunks;
+    // The address of every chunk in the file, in row-major order;
+    // `HADDR_UNDEF` if the chunk hasn't been allocated.
+    std::vector<uint64_t> _addresses;
+
+    int _fd = -1;
+};
+
+}  // namespace details
+
+///
+/// \brief Read an unfiltered dataset from many threads, bypassing HDF5.
+///
+/// HDF5 serializes all calls, even if built thread-safe. A `DirectReader`
+/// looks up the addresses of the contiguous storage or of all chunks once,
+/// when it's created, and later reads the data with `pread` from the file
+/// directly. Reading doesn't call HDF5 and any number of threads may read
+/// concurrently through the same reader:
+///
+/// \code{.cpp}
+/// auto reader = DirectReader<float>(file.getDataSet("features"));
+///
+/// // On any number of threads:
+/// auto row = std::vector<float>(n_cols);
+/// reader.read_raw({i, 0}, {1, n_cols}, row.data());
+/// \endcode
+///
+/// The dataset must be contiguous or chunked, without filters, and stored in
+/// a file using the default driver. The datatype in memory must be the
+/// datatype of the dataset, since there is no conversion. Chunks that were
+/// never written are read as the fill value.
+///
+/// The overloads taking a `Selection` or a container read the same elements,
+/// in the same order, as `Selection::read`. They accept any hyperslab
+/// selection, e.g. a `ProductSet`, but need HDF5 to obtain the selected
+/// blocks and the dimensions of the container; unless HDF5 was built
+/// thread-safe, they must not be called concurrently with other uses of HDF5.
+///
+/// The reader shows the dataset as it was when the reader was created; the
+/// dataset must not be modified, resized or moved while the reader is in use.
+/// Requires a POSIX system.
+///
+/// \since 3.4
+template <class T>
+class DirectReader: public details::DirectReaderBase {
+  public:
+    ///
+    /// \brief Prepare to read `dataset`.
+    ///
+    /// Flushes the file and snapshots the addresses of its data. Throws a
+    /// `DataSetException` if the dataset can't be read directly and a
+    /// `DataTypeException` if its datatype isn't the datatype of `T`.
+    explicit DirectReader(const DataSet& dataset);
+
+    ///
+    /// \brief Read the entire dataset into `array`.
+    template <class Container>
+    void read(Container& array) const;
+
+    ///
+    /// \brief Read the elements of `selection` into `array`.
+    ///
+    /// The `selection` must be a selection of the dataset passed to the
+    /// constructor.
+    template <class Container>
+    void read(const Selection& selection, Container& array) const;
+
+    ///
+    /// \brief Read the entire dataset into a contiguous, row-major array.
+    ///
+    /// Doesn't call HDF5.
+    void read_raw(T* array) const;
+
+    ///
+    /// \brief Read the elements of `selection` into a contiguous array.
+    void read_raw(const Selection& selection, T* array) const;
+
+    ///
+    /// \brief Read the block of `count` elements starting at `offset`.
+    ///
+    /// The elements are stored in row-major order. Doesn't call HDF5.
+    void read_raw(const std::vector<size_t>& offset,
+                  const std::vector<size_t>& count,
+                  T* array) const;
+
+  private:
+    template <class Container>
+    void read(const DataSpace& file_space, const DataSpace& mem_space, Container& array) const;
+};
+
+}  // namespace HighFive
+
+#include "bits/direct_reader_misc.hpp"
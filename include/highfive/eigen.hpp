@@ -9,6 +9,13 @@
 namespace HighFive {
 namespace details {
 
+template <class EigenType>
+struct eigen_has_default_stride: public std::true_type {};
+
+template <typename PlainObjectType, int MapOptions, class StrideType>
+struct eigen_has_default_stride<Eigen::Map<PlainObjectType, MapOptions, StrideType>>
+    : public std::is_same<StrideType, Eigen::Stride<0, 0>> {};
+
 template <class EigenType>
 struct eigen_inspector {
     using type = EigenType;
@@ -32,9 +39,13 @@ struct eigen_inspector {
     static constexpr size_t min_ndim = ndim + inspector<value_type>::min_ndim;
     static constexpr size_t max_ndim = ndim + inspector<value_type>::max_ndim;
     static constexpr bool is_trivially_copyable = is_row_major() &&
+                                                  eigen_has_default_stride<EigenType>::value &&
                                                   std::is_trivially_copyable<value_type>::value &&
                                                   inspector<value_type>::is_trivially_nestable;
     static constexpr bool is_trivially_nestable = false;
+    static constexpr bool is_strided = !is_trivially_copyable &&
+                                       std::is_same<value_type, hdf5_type>::value &&
+                                       std::is_trivially_copyable<value_type>::value;
 
     static size_t getRank(const type& val) {
         return ndim + inspector<value_type>::getRank(val.data()[0]);
@@ -47,7 +58,11 @@ struct eigen_inspector {
         return sizes;
     }
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
+    static std::vector<size_t> getStrides(const type& val) {
+        return {static_cast<size_t>(val.rowStride()), static_cast<size_t>(val.colStride())};
+    }
+
+    static void prepare(type& val, dims_view dims) {
         if (dims[0] != static_cast<size_t>(val.rows()) ||
             dims[1] != static_cast<size_t>(val.cols())) {
             val.resize(static_cast<typename type::Index>(dims[0]),
@@ -56,7 +71,7 @@ struct eigen_inspector {
     }
 
     static hdf5_type* data(type& val) {
-        if (!is_trivially_copyable) {
+        if (!is_trivially_copyable && !is_strided) {
             throw DataSetException("Invalid used of `inspector<Eigen::Matrix<...>>::data`.");
         }
 
@@ -64,18 +79,18 @@ struct eigen_inspector {
     }
 
     static const hdf5_type* data(const type& val) {
-        if (!is_trivially_copyable) {
+        if (!is_trivially_copyable && !is_strided) {
             throw DataSetException("Invalid used of `inspector<Eigen::Matrix<...>>::data`.");
         }
 
         return inspector<value_type>::data(*val.data());
     }
 
-    static void serialize(const type& val, const std::vector<size_t>& dims, hdf5_type* m) {
+    static void serialize(const type& val, dims_view dims, hdf5_type* m) {
         Eigen::Index n_rows = val.rows();
         Eigen::Index n_cols = val.cols();
 
-        auto subdims = std::vector<size_t>(dims.begin() + ndim, dims.end());
+        auto subdims = dims.drop_front(ndim);
         auto subsize = compute_total_size(subdims);
         for (Eigen::Index i = 0; i < n_rows; ++i) {
             for (Eigen::Index j = 0; j < n_cols; ++j) {
@@ -85,9 +100,7 @@ struct eigen_inspector {
         }
     }
 
-    static void unserialize(const hdf5_type* vec_align,
-                            const std::vector<size_t>& dims,
-                            type& val) {
+    static void unserialize(const hdf5_type* vec_align, dims_view dims, type& val) {
         if (dims.size() < 2) {
             std::ostringstream os;
             os << "Impossible to pair DataSet with " << dims.size()
@@ -98,7 +111,7 @@ struct eigen_inspector {
         auto n_rows = static_cast<Eigen::Index>(dims[0]);
         auto n_cols = static_cast<Eigen::Index>(dims[1]);
 
-        auto subdims = std::vector<size_t>(dims.begin() + ndim, dims.end());
+        auto subdims = dims.drop_front(ndim);
         auto subsize = compute_total_size(subdims);
         for (Eigen::Index i = 0; i < n_rows; ++i) {
             for (Eigen::Index j = 0; j < n_cols; ++j) {
@@ -136,11 +149,11 @@ struct inspector<Eigen::Array<T, M, N, Options>>
 };
 
 
-template <typename PlainObjectType, int MapOptions>
-struct inspector<Eigen::Map<PlainObjectType, MapOptions>>
-    : public eigen_inspector<Eigen::Map<PlainObjectType, MapOptions>> {
+template <typename PlainObjectType, int MapOptions, class StrideType>
+struct inspector<Eigen::Map<PlainObjectType, MapOptions, StrideType>>
+    : public eigen_inspector<Eigen::Map<PlainObjectType, MapOptions, StrideType>> {
   private:
-    using super = eigen_inspector<Eigen::Map<PlainObjectType, MapOptions>>;
+    using super = eigen_inspector<Eigen::Map<PlainObjectType, MapOptions, StrideType>>;
 
   public:
     using type = typename super::type;
@@ -148,7 +161,7 @@ struct inspector<Eigen::Map<PlainObjectType, MapOptions>>
     using base_type = typename super::base_type;
     using hdf5_type = typename super::hdf5_type;
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
+    static void prepare(type& val, dims_view dims) {
         if (dims[0] != static_cast<size_t>(val.rows()) ||
             dims[1] != static_cast<size_t>(val.cols())) {
             throw DataSetException("Eigen::Map has invalid shape and can't be resized.");
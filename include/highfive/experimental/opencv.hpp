@@ -85,8 +85,8 @@ struct inspector<cv::Mat_<T>> {
         return dims;
     }
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
-        auto subdims = detail::convertSizeVector<int>(dims);
+    static void prepare(type& val, dims_view dims) {
+        auto subdims = detail::convertSizeVector<int, size_t>(dims.begin(), dims.end());
         val.create(static_cast<int>(subdims.size()), subdims.data());
     }
 
@@ -118,13 +118,13 @@ struct inspector<cv::Mat_<T>> {
         return inspector<value_type>::data(getAnyElement(val));
     }
 
-    static void serialize(const type& val, const std::vector<size_t>& dims, hdf5_type* m) {
+    static void serialize(const type& val, dims_view dims, hdf5_type* m) {
         if (val.empty()) {
             return;
         }
 
         auto local_rank = val.dims;
-        auto subdims = std::vector<size_t>(dims.begin() + local_rank, dims.end());
+        auto subdims = dims.drop_front(static_cast<size_t>(local_rank));
         auto subsize = compute_total_size(subdims);
         for (auto it = val.begin(); it != val.end(); ++it) {
             inspector<value_type>::serialize(*it, subdims, m);
@@ -132,11 +132,9 @@ struct inspector<cv::Mat_<T>> {
         }
     }
 
-    static void unserialize(const hdf5_type* vec_align,
-                            const std::vector<size_t>& dims,
-                            type& val) {
+    static void unserialize(const hdf5_type* vec_align, dims_view dims, type& val) {
         auto local_rank = val.dims;
-        auto subdims = std::vector<size_t>(dims.begin() + local_rank, dims.end());
+        auto subdims = dims.drop_front(static_cast<size_t>(local_rank));
         auto subsize = compute_total_size(subdims);
         for (auto it = val.begin(); it != val.end(); ++it) {
             inspector<value_type>::unserialize(vec_align, subdims, *it);
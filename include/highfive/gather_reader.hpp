@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "H5DataSet.hpp"
+#include "H5DataSpace.hpp"
+#include "H5DataType.hpp"
+#include "H5Selection.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// The part of `GatherReader` that doesn't depend on the element type.
+class GatherReaderBase {
+  public:
+    ///
+    /// \brief The maximum number of bytes read by a single `H5Dread`.
+    size_t getMaxStagingBytes() const noexcept {
+        return _max_staging_bytes;
+    }
+
+    ///
+    /// \brief The dimensions of the dataset, when the reader was created.
+    const std::vector<size_t>& getDimensions() const noexcept {
+        return _dims;
+    }
+
+    ///
+    /// \brief Number of calls to `H5Dread` made by the last read.
+    size_t getNumberOfReads() const noexcept {
+        return _n_reads;
+    }
+
+  protected:
+    GatherReaderBase(const DataSet& dataset,
+                     const DataType& mem_datatype,
+                     size_t max_staging_bytes);
+
+    // Reads the `n_points` points, whose coordinates are stored one after the
+    // other in `coordinates`, into `buffer` in the same order.
+    void gatherBytes(const size_t* coordinates, size_t n_points, uint8_t* buffer);
+
+  private:
+    // Reads the points `order[begin], ..., order[end - 1]`, all in the same
+    // tile, by reading their bounding box. Returns `false`, without reading,
+    // if the bounding box is larger than the staging memory.
+    bool readTile(const size_t* coordinates,
+                  const std::vector<size_t>& order,
+                  size_t begin,
+                  size_t end,
+                  uint8_t* buffer);
+
+    // Reads the listed points with element selections, in batches.
+    void readPoints(const size_t* coordinates,
+                    const std::vector<size_t>& points,
+                    uint8_t* buffer);
+
+    DataSet _dataset;
+    DataType _mem_datatype;
+    DataSpace _file_space;
+    std::vector<size_t> _dims;
+    size_t _element_size;
+    size_t _max_staging_bytes;
+
+    // Points in the same tile are read together; a tile is a chunk, or a
+    // part of a row of a contiguous dataset.
+    std::vector<size_t> _tile_dims;
+    std::vector<size_t> _n_tiles;
+
+    std::vector<uint8_t> _staging;
+    size_t _n_reads = 0;
+    size_t _n_staged_bytes = 0;
+};
+
+}  // namespace details
+
+///
+/// \brief Read scattered elements of a dataset, in any order, efficiently.
+///
+/// Selecting the elements with an `ElementSet` lets HDF5 visit them in the
+/// requested order. If they're unsorted and the dataset is chunked and
+/// compressed, the same chunk is typically decompressed many times. A
+/// `GatherReader` instead sorts the points by chunk, reads the bounding box
+/// of the requested points of each chunk once, and scatters the values back
+/// to the requested order:
+///
+/// \code{.cpp}
+/// auto reader = GatherReader<double>(file.getDataSet("table"));
+/// auto values = std::vector<double>{};
+/// reader.read(ElementSet({{i0, j0}, {i1, j1}, {i2, j2}}), values);
+/// \endcode
+///
+/// Contiguous datasets are split into parts of rows, called tiles, of at
+/// most `max_staging_bytes`; points close to each other in the same row are
+/// read with one `H5Dread`. Isolated points, and points of a tile whose
+/// bounding box is larger than `max_staging_bytes`, are read in batches of
+/// element selections, sorted. No `H5Dread` reads more than
+/// `max_staging_bytes`.
+///
+/// Points may repeat. HDF5 converts the datatype as usual.
+///
+/// \since 3.4
+template <class T>
+class GatherReader: public details::GatherReaderBase {
+  public:
+    ///
+    /// \brief Prepare to read from `dataset`.
+    ///
+    /// Throws a `DataSetException` if the dataset is scalar.
+    explicit GatherReader(const DataSet& dataset, size_t max_staging_bytes = size_t(16) << 20);
+
+    ///
+    /// \brief Read the points of `elements`, in the same order.
+    void read(const ElementSet& elements, std::vector<T>& values);
+
+    ///
+    /// \brief Read the points of `elements`, in the same order.
+    std::vector<T> read(const ElementSet& elements);
+
+    ///
+    /// \brief Read `n_points` points into `values`.
+    ///
+    /// The coordinates of the points are stored one after the other in
+    /// `coordinates`, i.e. `coordinates` contains `n_points * rank` indices.
+    void read_raw(const size_t* coordinates, size_t n_points, T* values);
+};
+
+}  // namespace HighFive
+
+#include "bits/gather_reader_misc.hpp"
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+
+#include "../H5Easy.hpp"
+#include "../H5Utility.hpp"
+#include "H5Easy_misc.hpp"
+
+namespace H5Easy {
+
+namespace detail {
+
+// Number of elements per chunk of a Series: about 64 KiB.
+inline hsize_t series_chunk_size(size_t element_size) {
+    return std::max(hsize_t(1), hsize_t(64 * 1024 / std::max(element_size, size_t(1))));
+}
+
+// get a opened DataSet: one-dimensional, extendible
+template <class T>
+inline DataSet initSeriesDataset(File& file, const std::string& path, const DumpOptions& options) {
+    if (file.exist(path)) {
+        if (file.getObjectType(path) != ObjectType::Dataset) {
+            throw dump_error(file, path);
+        }
+
+        DataSet dataset = file.getDataSet(path);
+        if (dataset.getDimensions().size() != 1) {
+            throw error(file, path, "H5Easy::Series: Existing field not one-dimensional");
+        }
+        return dataset;
+    }
+
+    auto datatype = HighFive::create_datatype<T>();
+    std::vector<hsize_t> chunks = {series_chunk_size(datatype.getSize())};
+    if (options.isChunked()) {
+        chunks = options.getChunkSize();
+        if (chunks.size() != 1) {
+            throw error(file, path, "H5Easy::Series: Incorrect rank ChunkSize");
+        }
+    }
+
+    DataSetCreateProps props;
+    props.add(Chunking(chunks));
+    if (options.compress()) {
+        props.add(Shuffle());
+        props.add(Deflate(options.getCompressionLevel()));
+    }
+
+    DataSpace dataspace({0}, {DataSpace::UNLIMITED});
+    return file.createDataSet(path, dataspace, datatype, props, {}, true);
+}
+
+}  // namespace detail
+
+template <class T>
+inline Series<T>::Series(File& file, const std::string& path, const DumpOptions& options)
+    : m_file(file)
+    , m_dataset(detail::initSeriesDataset<T>(file, path, options))
+    , m_appender(m_dataset)
+    , m_flush(options.flush()) {}
+
+template <class T>
+inline Series<T>::~Series() {
+    try {
+        flush();
+    } catch (const std::exception& err) {
+        HIGHFIVE_LOG_ERROR("H5Easy::Series: failed to flush '" + m_dataset.getPath() +
+                           "': " + err.what());
+    }
+}
+
+template <class T>
+inline void Series<T>::push_back(const T& value) {
+    m_appender.append(value);
+}
+
+template <class T>
+inline void Series<T>::flush() {
+    m_appender.flush();
+    if (m_flush) {
+        m_file.flush();
+    }
+}
+
+template <class T>
+inline size_t Series<T>::size() const {
+    return m_appender.size();
+}
+
+template <class T>
+inline DataSet Series<T>::getDataSet() const {
+    return m_dataset;
+}
+
+}  // namespace H5Easy
@@ -1,13 +1,23 @@
 #pragma once
 
+#include <highfive/H5Allocator.hpp>
+#include <highfive/H5Appender.hpp>
 #include <highfive/H5Attribute.hpp>
+#include <highfive/H5ChunkRange.hpp>
+#include <highfive/H5CompiledSelection.hpp>
 #include <highfive/H5DataSet.hpp>
 #include <highfive/H5DataSpace.hpp>
 #include <highfive/H5DataType.hpp>
 #include <highfive/H5File.hpp>
 #include <highfive/H5Group.hpp>
+#include <highfive/H5Instrumentation.hpp>
+#include <highfive/H5MappedArray.hpp>
+#include <highfive/H5MultiTransfer.hpp>
 #include <highfive/H5PropertyList.hpp>
 #include <highfive/H5Reference.hpp>
 #include <highfive/H5Selection.hpp>
+#include <highfive/H5StringTable.hpp>
+#include <highfive/H5Trace.hpp>
+#include <highfive/H5TransferBuffer.hpp>
 #include <highfive/H5Utility.hpp>
 #include <highfive/H5Version.hpp>
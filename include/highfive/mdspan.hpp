@@ -27,17 +27,25 @@ struct inspector<std::mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>
     static constexpr size_t min_ndim = ndim + inspector<value_type>::min_ndim;
     static constexpr size_t max_ndim = ndim + inspector<value_type>::max_ndim;
 
-    static constexpr bool is_trivially_copyable =
-        std::is_trivially_copyable<value_type>::value &&
-        inspector<value_type>::is_trivially_nestable &&
-        (std::is_same_v<std::default_accessor<value_type>, accessor_type>
+  private:
+    static constexpr bool has_plain_accessor =
+        std::is_same_v<std::default_accessor<value_type>, accessor_type>
 #ifdef __cpp_lib_aligned_accessor
-         || std::is_same_v<std::aligned_accessor<value_type>, accessor_type>
+        || std::is_same_v<std::aligned_accessor<value_type>, accessor_type>
 #endif
-         ) &&
+        ;
+
+  public:
+    static constexpr bool is_trivially_copyable =
+        std::is_trivially_copyable<value_type>::value &&
+        inspector<value_type>::is_trivially_nestable && has_plain_accessor &&
         (std::is_same_v<typename type::layout_type, std::layout_right> ||
          (std::is_same_v<typename type::layout_type, std::layout_left> && ndim == 1));
     static constexpr bool is_trivially_nestable = false;
+    static constexpr bool is_strided = !is_trivially_copyable &&
+                                       std::is_same_v<value_type, hdf5_type> &&
+                                       std::is_trivially_copyable<value_type>::value &&
+                                       has_plain_accessor && type::is_always_strided();
 
   private:
     using index_type = typename extents_type::index_type;
@@ -50,7 +58,7 @@ struct inspector<std::mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>
 
     template <typename T>
     static auto data_impl(T& val) -> decltype(inspector<value_type>::data(*val.data_handle())) {
-        if (!is_trivially_copyable) {
+        if (!is_trivially_copyable && !is_strided) {
             throw DataSetException("Invalid use of `inspector<std::mdspan<...>>::data`.");
         }
 
@@ -82,7 +90,16 @@ struct inspector<std::mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>
         return sizes;
     }
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
+    static std::vector<size_t> getStrides(const type& val) {
+        std::vector<size_t> strides;
+        strides.reserve(ndim);
+        for (size_t r = 0; r < ndim; ++r) {
+            strides.push_back(static_cast<size_t>(val.stride(r)));
+        }
+        return strides;
+    }
+
+    static void prepare(type& val, dims_view dims) {
         if (dims.size() < ndim) {
             std::ostringstream os;
             os << "Impossible to pair DataSet with " << dims.size()
@@ -109,8 +126,8 @@ struct inspector<std::mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>
         return data_impl(val);
     }
 
-    static void serialize(const type& val, const std::vector<size_t>& dims, hdf5_type* m) {
-        auto subdims = std::vector<size_t>(dims.begin() + ndim, dims.end());
+    static void serialize(const type& val, dims_view dims, hdf5_type* m) {
+        auto subdims = dims.drop_front(ndim);
         auto subsize = compute_total_size(subdims);
 
         std::array<index_type, ndim> indices{};
@@ -131,9 +148,7 @@ struct inspector<std::mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>
         iterate(iterate, 0);
     }
 
-    static void unserialize(const hdf5_type* vec_align,
-                            const std::vector<size_t>& dims,
-                            type& val) {
+    static void unserialize(const hdf5_type* vec_align, dims_view dims, type& val) {
         if (dims.size() < ndim) {
             std::ostringstream os;
             os << "Impossible to pair DataSet with " << dims.size()
@@ -141,7 +156,7 @@ struct inspector<std::mdspan<ElementType, Extents, LayoutPolicy, AccessorPolicy>
             throw DataSpaceException(os.str());
         }
 
-        auto subdims = std::vector<size_t>(dims.begin() + ndim, dims.end());
+        auto subdims = dims.drop_front(ndim);
         auto subsize = compute_total_size(subdims);
 
         std::array<index_type, ndim> indices{};
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "H5ChunkRange.hpp"
+#include "H5DataSet.hpp"
+#include "H5Selection.hpp"
+#include "bits/chunk_filters.hpp"
+#include "bits/thread_pool.hpp"
+
+namespace HighFive {
+
+namespace details {
+
+// State shared by `ParallelChunkWriter` and `ParallelChunkReader`.
+class ParallelChunkBase {
+  public:
+    ///
+    /// \brief Number of worker threads.
+    size_t getNumberThreads() const noexcept;
+
+  protected:
+    ParallelChunkBase(const DataSet& dataset, size_t n_threads);
+
+    // Throws unless chunks can be copied to (from) memory of `mem_datatype` as is.
+    void checkDataType(const DataType& mem_datatype, const std::string& operation) const;
+
+    // Number of bytes of an unfiltered chunk.
+    size_t getChunkBytes() const;
+
+    DataSet _dataset;
+    ChunkRange _chunks;
+    std::vector<size_t> _dims;
+    size_t _element_size;
+    std::vector<uint8_t> _fill_value;
+    ChunkFilterPipeline _pipeline;
+    std::unique_ptr<ThreadPool> _pool;
+};
+
+}  // namespace details
+
+///
+/// \brief Write a compressed dataset by filtering its chunks on a thread pool.
+///
+/// HDF5 runs the filter pipeline, e.g. `Shuffle` and `Deflate`, on the thread
+/// calling `H5Dwrite`, one chunk after the other. A `ParallelChunkWriter`
+/// instead splits the buffer into chunks, as specified by the dataset's
+/// `Chunking`, shuffles and compresses them concurrently and then writes the
+/// filtered chunks, in order, with `DataSet::writeChunk`. The chunks in the
+/// file are identical to those written by `DataSet::write`.
+///
+/// \code{.cpp}
+/// auto props = DataSetCreateProps{};
+/// props.add(Chunking({1024, 1024}));
+/// props.add(Shuffle());
+/// props.add(Deflate(6));
+/// auto dset = file.createDataSet<float>("x", DataSpace({n, m}), props);
+///
+/// auto writer = ParallelChunkWriter(dset, /* n_threads = */ 8);
+/// writer.write(values);
+/// \endcode
+///
+/// Only the shuffle and deflate filters are supported. The datatype in
+/// memory must be the same as the datatype of the dataset, since chunks are
+/// written without conversion. This header requires zlib and, depending on
+/// the platform, linking with the threading library.
+///
+/// All HDF5 calls are made from the thread calling `write`.
+///
+/// \since 3.4
+class ParallelChunkWriter: public details::ParallelChunkBase {
+  public:
+    ///
+    /// \brief Prepare to write `dataset` using `n_threads` worker threads.
+    ///
+    /// If `n_threads` is `0`, one thread per hardware thread is used. Throws a
+    /// `DataSetException` if the dataset isn't chunked or uses an unsupported
+    /// filter.
+    explicit ParallelChunkWriter(const DataSet& dataset, size_t n_threads = 0);
+
+    ///
+    /// \brief Write the entire dataset from `buffer`.
+    template <class T>
+    void write(const T& buffer);
+
+    ///
+    /// \brief Write the entire dataset from a contiguous, row-major array.
+    template <class T>
+    void write_raw(const T* buffer);
+
+  private:
+    void writeBytes(const uint8_t* buffer);
+    std::vector<uint8_t> filterChunk(const uint8_t* buffer, size_t chunk_index) const;
+};
+
+///
+/// \brief Read a compressed dataset by unfiltering its chunks on a thread pool.
+///
+/// The counterpart of `ParallelChunkWriter`. The raw chunks intersecting the
+/// selection are read, in order, with `DataSet::readChunk`. Decompressing,
+/// unshuffling and copying the selected elements into the destination
+/// happens concurrently on the worker threads. Each chunk is read only once,
+/// regardless of how many blocks of the selection it intersects.
+///
+/// \code{.cpp}
+/// auto reader = ParallelChunkReader(dset, /* n_threads = */ 8);
+/// auto values = std::vector<std::vector<float>>{};
+/// reader.read(dset.select(HyperSlab(RegularHyperSlab({0, 0}, {n, 1024}))), values);
+/// \endcode
+///
+/// Selections must consist of hyperslabs, i.e. any `HyperSlab` including
+/// unions of blocks; element selections aren't supported. The elements are
+/// stored in the same order as `Selection::read` would. Chunks that were
+/// never written are read as the fill value.
+///
+/// The same restrictions on filters and datatypes as for
+/// `ParallelChunkWriter` apply. All HDF5 calls are made from the thread
+/// calling `read`.
+///
+/// \since 3.4
+class ParallelChunkReader: public details::ParallelChunkBase {
+  public:
+    ///
+    /// \brief Prepare to read `dataset` using `n_threads` worker threads.
+    ///
+    /// If `n_threads` is `0`, one thread per hardware thread is used. Throws a
+    /// `DataSetException` if the dataset isn't chunked or uses an unsupported
+    /// filter.
+    explicit ParallelChunkReader(const DataSet& dataset, size_t n_threads = 0);
+
+    ///
+    /// \brief Read the entire dataset into `array`.
+    template <class T>
+    void read(T& array);
+
+    ///
+    /// \brief Read the elements of `selection` into `array`.
+    ///
+    /// The `selection` must be a selection of the dataset passed to the
+    /// constructor.
+    template <class T>
+    void read(const Selection& selection, T& array);
+
+    ///
+    /// \brief Read the entire dataset into a contiguous, row-major array.
+    template <class T>
+    void read_raw(T* array);
+
+    ///
+    /// \brief Read the elements of `selection` into a contiguous array.
+    template <class T>
+    void read_raw(const Selection& selection, T* array);
+
+  private:
+    template <class T>
+    void read(const DataSpace& file_space, const DataSpace& mem_space, T& array);
+
+    void readBytes(const DataSpace& file_space, uint8_t* buffer);
+};
+
+}  // namespace HighFive
+
+#include "bits/parallel_chunks_misc.hpp"
@@ -48,6 +48,9 @@ struct xtensor_inspector_base {
                                                   inspector<value_type>::is_trivially_copyable;
 
     static constexpr bool is_trivially_nestable = false;
+    static constexpr bool is_strided = L == xt::layout_type::column_major &&
+                                       std::is_trivially_copyable<value_type>::value &&
+                                       inspector<value_type>::is_trivially_copyable;
 
     static size_t getRank(const type& val) {
         // Non-scalar elements are not supported.
@@ -67,12 +70,17 @@ struct xtensor_inspector_base {
         return {shape.begin(), shape.end()};
     }
 
-    static void prepare(type& val, const std::vector<size_t>& dims) {
-        val.resize(Derived::shapeFromDims(dims));
+    static std::vector<size_t> getStrides(const type& val) {
+        auto strides = val.strides();
+        return {strides.begin(), strides.end()};
+    }
+
+    static void prepare(type& val, dims_view dims) {
+        val.resize(Derived::shapeFromDims(std::vector<size_t>(dims.begin(), dims.end())));
     }
 
     static hdf5_type* data(type& val) {
-        if (!is_trivially_copyable) {
+        if (!is_trivially_copyable && !is_strided) {
             throw DataSetException("Invalid used of `inspector<XTensor>::data`.");
         }
 
@@ -84,7 +92,7 @@ struct xtensor_inspector_base {
     }
 
     static const hdf5_type* data(const type& val) {
-        if (!is_trivially_copyable) {
+        if (!is_trivially_copyable && !is_strided) {
             throw DataSetException("Invalid used of `inspector<XTensor>::data`.");
         }
 
@@ -95,18 +103,18 @@ struct xtensor_inspector_base {
         return inspector<value_type>::data(getAnyElement(val));
     }
 
-    static void serialize(const type& val, const std::vector<size_t>& dims, hdf5_type* m) {
+    static void serialize(const type& val, dims_view dims, hdf5_type* m) {
         // since we only support scalar types we know all dims belong to us.
-        size_t size = compute_total_size(dims);
-        xt::adapt(m, size, xt::no_ownership(), dims) = val;
+        auto shape = std::vector<size_t>(dims.begin(), dims.end());
+        size_t size = compute_total_size(shape);
+        xt::adapt(m, size, xt::no_ownership(), shape) = val;
     }
 
-    static void unserialize(const hdf5_type* vec_align,
-                            const std::vector<size_t>& dims,
-                            type& val) {
+    static void unserialize(const hdf5_type* vec_align, dims_view dims, type& val) {
         // since we only support scalar types we know all dims belong to us.
-        size_t size = compute_total_size(dims);
-        val = xt::adapt(vec_align, size, xt::no_ownership(), dims);
+        auto shape = std::vector<size_t>(dims.begin(), dims.end());
+        size_t size = compute_total_size(shape);
+        val = xt::adapt(vec_align, size, xt::no_ownership(), shape);
     }
 };
 
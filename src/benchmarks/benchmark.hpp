@@ -0,0 +1,150 @@
+/*
+ *  Copyright (c), 2026, HighFive Developers
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+// The timings of one benchmark, i.e. one operation on one case by one
+// implementation, e.g. `write` of `std::vector<double>` by `hdf5`.
+struct Result {
+    std::string name;
+    std::string operation;
+    std::string implementation;
+    size_t bytes;
+    std::vector<double> seconds;  // one per call
+
+    double min() const {
+        return *std::min_element(seconds.begin(), seconds.end());
+    }
+
+    double median() const {
+        auto sorted = seconds;
+        std::sort(sorted.begin(), sorted.end());
+        auto n = sorted.size();
+        return n % 2 == 1 ? sorted[n / 2] : 0.5 * (sorted[n / 2 - 1] + sorted[n / 2]);
+    }
+
+    double mean() const {
+        return std::accumulate(seconds.begin(), seconds.end(), 0.0) / double(seconds.size());
+    }
+};
+
+struct Options {
+    size_t repetitions = 20;
+    size_t warmup = 2;
+    std::string filter;
+};
+
+// Runs and records benchmarks. Every call of `run` times one function,
+// `repetitions` times after `warmup` untimed calls.
+class Suite {
+  public:
+    explicit Suite(Options options)
+        : _options(std::move(options)) {}
+
+    bool isSelected(const std::string& name) const {
+        return _options.filter.empty() || name.find(_options.filter) != std::string::npos;
+    }
+
+    void run(const std::string& name,
+             const std::string& operation,
+             const std::string& implementation,
+             size_t bytes,
+             const std::function<void()>& f) {
+        if (!isSelected(name)) {
+            return;
+        }
+
+        for (size_t i = 0; i < _options.warmup; ++i) {
+            f();
+        }
+
+        auto result = Result{name, operation, implementation, bytes, {}};
+        for (size_t i = 0; i < _options.repetitions; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            f();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            result.seconds.push_back(elapsed.count());
+        }
+
+        std::cerr << std::left << std::setw(48) << name << std::setw(8) << operation
+                  << std::setw(10) << implementation << std::right << std::setw(12)
+                  << 1e6 * result.median() << " us\n";
+        _results.push_back(std::move(result));
+    }
+
+    // The results as JSON. Results of `highfive` contain the ratio of their
+    // median to the median of `hdf5` for the same case and operation.
+    void writeJSON(std::ostream& out, const std::vector<std::string>& context) const {
+        out << std::setprecision(9);
+        out << "{\n  \"context\": {\n";
+        for (size_t i = 0; i < context.size(); ++i) {
+            out << "    " << context[i] << (i + 1 < context.size() ? ",\n" : "\n");
+        }
+        out << "  },\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < _results.size(); ++i) {
+            const auto& r = _results[i];
+            out << "    {\"name\": " << quote(r.name) << ", \"operation\": " << quote(r.operation)
+                << ", \"implementation\": " << quote(r.implementation)
+                << ", \"bytes\": " << r.bytes << ", \"calls\": " << r.seconds.size()
+                << ", \"min_ns\": " << 1e9 * r.min() << ", \"median_ns\": " << 1e9 * r.median()
+                << ", \"mean_ns\": " << 1e9 * r.mean()
+                << ", \"bytes_per_second\": " << double(r.bytes) / r.median();
+
+            const auto* baseline = find(r.name, r.operation, "hdf5");
+            if (r.implementation != "hdf5" && baseline != nullptr) {
+                out << ", \"overhead\": " << r.median() / baseline->median();
+            }
+            out << "}" << (i + 1 < _results.size() ? ",\n" : "\n");
+        }
+        out << "  ]\n}\n";
+    }
+
+    static std::string quote(const std::string& s) {
+        std::ostringstream out;
+        out << '"';
+        for (char c: s) {
+            if (c == '"' || c == '\\') {
+                out << '\\';
+            }
+            out << c;
+        }
+        out << '"';
+        return out.str();
+    }
+
+  private:
+    const Result* find(const std::string& name,
+                       const std::string& operation,
+                       const std::string& implementation) const {
+        for (const auto& r: _results) {
+            if (r.name == name && r.operation == operation &&
+                r.implementation == implementation) {
+                return &r;
+            }
+        }
+        return nullptr;
+    }
+
+    Options _options;
+    std::vector<Result> _results;
+};
+
+}  // namespace bench
@@ -0,0 +1,589 @@
+/*
+ *  Copyright (c), 2026, HighFive Developers
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+// Measures the throughput and per-call latency of reading and writing
+// various containers and selections with HighFive, and of the equivalent
+// calls of the HDF5 C API on contiguous buffers. The difference is the
+// overhead of HighFive.
+//
+// Usage:
+//     highfive_benchmarks [--output FILE] [--filter SUBSTRING]
+//                         [--size N] [--repetitions N]
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <highfive/gather_reader.hpp>
+#include <highfive/highfive.hpp>
+
+#ifdef HIGHFIVE_TEST_EIGEN
+#include <highfive/eigen.hpp>
+#endif
+
+#ifdef HIGHFIVE_TEST_XTENSOR
+#include <highfive/xtensor.hpp>
+#if HIGHFIVE_XTENSOR_HEADER_VERSION == 1
+#include <xtensor/xtensor.hpp>
+#elif HIGHFIVE_XTENSOR_HEADER_VERSION == 2
+#include <xtensor/containers/xtensor.hpp>
+#endif
+#endif
+
+#ifdef HIGHFIVE_TEST_MDSPAN
+#include <mdspan>
+#include <highfive/mdspan.hpp>
+#endif
+
+#include "benchmark.hpp"
+
+using namespace HighFive;
+
+struct Particle {
+    double x;
+    double y;
+    double z;
+    float mass;
+    int id;
+};
+
+CompoundType create_compound_particle() {
+    return {{"x", create_datatype<double>()},
+            {"y", create_datatype<double>()},
+            {"z", create_datatype<double>()},
+            {"mass", create_datatype<float>()},
+            {"id", create_datatype<int>()}};
+}
+
+HIGHFIVE_REGISTER_TYPE(Particle, create_compound_particle)
+
+namespace {
+
+// Number of columns of two-dimensional cases.
+constexpr size_t n_cols = 16;
+
+void check(herr_t err, const char* what) {
+    if (err < 0) {
+        throw std::runtime_error(std::string("HDF5 call failed: ") + what);
+    }
+}
+
+// Times `read` and `write` of `values` with HighFive, and `H5Dread` and
+// `H5Dwrite` of the contiguous buffer `raw` with the memory type `mem_type`.
+template <class T, class U>
+void compare_dataset(bench::Suite& suite,
+                     const std::string& name,
+                     DataSet& dset,
+                     T& values,
+                     std::vector<U>& raw,
+                     hid_t mem_type) {
+    auto bytes = raw.size() * sizeof(U);
+    suite.run(name, "write", "highfive", bytes, [&]() { dset.write(values); });
+    suite.run(name, "write", "hdf5", bytes, [&]() {
+        check(H5Dwrite(dset.getId(), mem_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, raw.data()),
+              "H5Dwrite");
+    });
+    suite.run(name, "read", "highfive", bytes, [&]() { dset.read(values); });
+    suite.run(name, "read", "hdf5", bytes, [&]() {
+        check(H5Dread(dset.getId(), mem_type, H5S_ALL, H5S_ALL, H5P_DEFAULT, raw.data()),
+              "H5Dread");
+    });
+}
+
+std::vector<double> iota(size_t n) {
+    auto values = std::vector<double>(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = double(i);
+    }
+    return values;
+}
+
+void bench_vector(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("std::vector<double>");
+    if (suite.isSelected(name)) {
+        auto values = iota(n);
+        auto raw = values;
+        auto dset = file.createDataSet<double>("vector", DataSpace({n}));
+        compare_dataset(suite, name, dset, values, raw, H5T_NATIVE_DOUBLE);
+    }
+}
+
+void bench_nested_vector(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("std::vector<std::vector<double>>");
+    if (suite.isSelected(name)) {
+        auto n_rows = n / n_cols;
+        auto values = std::vector<std::vector<double>>(n_rows, iota(n_cols));
+        auto raw = iota(n_rows * n_cols);
+        auto dset = file.createDataSet<double>("nested_vector", DataSpace({n_rows, n_cols}));
+        compare_dataset(suite, name, dset, values, raw, H5T_NATIVE_DOUBLE);
+    }
+}
+
+// Many short rows; the cost per row of the inspectors dominates.
+void bench_deeply_nested_vector(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("std::vector<std::vector<std::vector<double>>>");
+    if (suite.isSelected(name)) {
+        size_t m = 8, k = 4;
+        auto n_blocks = n / (m * k);
+        using nested_type = std::vector<std::vector<std::vector<double>>>;
+        auto values = nested_type(n_blocks, std::vector<std::vector<double>>(m, iota(k)));
+        auto raw = iota(n_blocks * m * k);
+        auto dset = file.createDataSet<double>("deeply_nested_vector",
+                                               DataSpace({n_blocks, m, k}));
+        compare_dataset(suite, name, dset, values, raw, H5T_NATIVE_DOUBLE);
+    }
+}
+
+void bench_array(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("std::vector<std::array<double, 16>>");
+    if (suite.isSelected(name)) {
+        auto n_rows = n / n_cols;
+        auto values = std::vector<std::array<double, n_cols>>(n_rows);
+        auto raw = iota(n_rows * n_cols);
+        auto dset = file.createDataSet<double>("array", DataSpace({n_rows, n_cols}));
+        compare_dataset(suite, name, dset, values, raw, H5T_NATIVE_DOUBLE);
+    }
+}
+
+std::vector<std::string> make_strings(size_t n) {
+    auto values = std::vector<std::string>(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = "string " + std::to_string(i);
+    }
+    return values;
+}
+
+void bench_fixed_length_strings(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("std::vector<std::string> (fixed length)");
+    if (suite.isSelected(name)) {
+        constexpr size_t length = 16;
+        auto n_strings = n / length;
+        auto values = make_strings(n_strings);
+        auto raw = std::vector<char>(n_strings * length, '\0');
+        for (size_t i = 0; i < n_strings; ++i) {
+            std::strncpy(raw.data() + i * length, values[i].c_str(), length - 1);
+        }
+
+        auto dtype = FixedLengthStringType(length, StringPadding::NullTerminated);
+        auto dset = file.createDataSet("fixed_length_strings", DataSpace({n_strings}), dtype);
+        compare_dataset(suite, name, dset, values, raw, dtype.getId());
+    }
+}
+
+void bench_variable_length_strings(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("std::vector<std::string> (variable length)");
+    if (!suite.isSelected(name)) {
+        return;
+    }
+
+    auto n_strings = n / 16;
+    auto values = make_strings(n_strings);
+    auto dtype = VariableLengthStringType();
+    auto dset = file.createDataSet("variable_length_strings", DataSpace({n_strings}), dtype);
+
+    auto pointers = std::vector<const char*>(n_strings);
+    for (size_t i = 0; i < n_strings; ++i) {
+        pointers[i] = values[i].c_str();
+    }
+
+    auto bytes = n_strings * sizeof(char*);
+    suite.run(name, "write", "highfive", bytes, [&]() { dset.write(values); });
+    suite.run(name, "write", "hdf5", bytes, [&]() {
+        check(H5Dwrite(dset.getId(), dtype.getId(), H5S_ALL, H5S_ALL, H5P_DEFAULT, pointers.data()),
+              "H5Dwrite");
+    });
+
+    suite.run(name, "read", "highfive", bytes, [&]() { dset.read(values); });
+    suite.run(name, "read", "hdf5", bytes, [&]() {
+        auto buffer = std::vector<char*>(n_strings);
+        check(H5Dread(dset.getId(), dtype.getId(), H5S_ALL, H5S_ALL, H5P_DEFAULT, buffer.data()),
+              "H5Dread");
+        auto space = dset.getSpace();
+#if H5_VERSION_GE(1, 12, 0)
+        check(H5Treclaim(dtype.getId(), space.getId(), H5P_DEFAULT, buffer.data()), "H5Treclaim");
+#else
+        check(H5Dvlen_reclaim(dtype.getId(), space.getId(), H5P_DEFAULT, buffer.data()),
+              "H5Dvlen_reclaim");
+#endif
+    });
+}
+
+void bench_compound(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("std::vector<Particle> (compound)");
+    if (suite.isSelected(name)) {
+        auto n_particles = n * sizeof(double) / sizeof(Particle);
+        auto values = std::vector<Particle>(n_particles, Particle{1.0, 2.0, 3.0, 4.0f, 5});
+        auto raw = values;
+        auto dtype = create_datatype<Particle>();
+        auto dset = file.createDataSet<Particle>("compound", DataSpace({n_particles}));
+        compare_dataset(suite, name, dset, values, raw, dtype.getId());
+    }
+}
+
+void bench_element_set(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("ElementSet (every 16th element)");
+    if (!suite.isSelected(name)) {
+        return;
+    }
+
+    auto dset = file.createDataSet("element_set", iota(n));
+    auto n_selected = n / 16;
+    auto ids = std::vector<size_t>(n_selected);
+    auto coords = std::vector<hsize_t>(n_selected);
+    for (size_t i = 0; i < n_selected; ++i) {
+        ids[i] = 16 * i;
+        coords[i] = hsize_t(ids[i]);
+    }
+    auto values = iota(n_selected);
+    auto bytes = n_selected * sizeof(double);
+
+    // The HDF5 baseline includes creating the selection, as HighFive does.
+    auto raw_transfer = [&](bool is_read) {
+        auto file_space = H5Dget_space(dset.getId());
+        check(H5Sselect_elements(file_space, H5S_SELECT_SET, n_selected, coords.data()),
+              "H5Sselect_elements");
+        auto count = hsize_t(n_selected);
+        auto mem_space = H5Screate_simple(1, &count, nullptr);
+        auto err = is_read ? H5Dread(dset.getId(),
+                                     H5T_NATIVE_DOUBLE,
+                                     mem_space,
+                                     file_space,
+                                     H5P_DEFAULT,
+                                     values.data())
+                           : H5Dwrite(dset.getId(),
+                                      H5T_NATIVE_DOUBLE,
+                                      mem_space,
+                                      file_space,
+                                      H5P_DEFAULT,
+                                      values.data());
+        H5Sclose(mem_space);
+        H5Sclose(file_space);
+        check(err, is_read ? "H5Dread" : "H5Dwrite");
+    };
+
+    suite.run(name, "write", "highfive", bytes, [&]() {
+        dset.select(ElementSet(ids)).write(values);
+    });
+    suite.run(name, "write", "hdf5", bytes, [&]() { raw_transfer(false); });
+    suite.run(name, "read", "highfive", bytes, [&]() {
+        dset.select(ElementSet(ids)).read(values);
+    });
+    suite.run(name, "read", "hdf5", bytes, [&]() { raw_transfer(true); });
+}
+
+void bench_gather(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("GatherReader (random points, compressed chunks)");
+    if (!suite.isSelected(name)) {
+        return;
+    }
+
+    auto props = DataSetCreateProps{};
+    props.add(Chunking({4096}));
+    props.add(Deflate(1));
+    auto dset = file.createDataSet("gather", iota(n), props);
+
+    auto n_selected = n / 64;
+    auto ids = std::vector<size_t>(n_selected);
+    auto coords = std::vector<hsize_t>(n_selected);
+    auto state = uint32_t(12345);
+    for (size_t i = 0; i < n_selected; ++i) {
+        state = state * 1664525u + 1013904223u;
+        ids[i] = size_t(state) % n;
+        coords[i] = hsize_t(ids[i]);
+    }
+    auto values = std::vector<double>(n_selected);
+    auto bytes = n_selected * sizeof(double);
+
+    auto reader = GatherReader<double>(dset);
+    suite.run(name, "read", "highfive", bytes, [&]() {
+        reader.read_raw(ids.data(), n_selected, values.data());
+    });
+    suite.run(name, "read", "hdf5", bytes, [&]() {
+        auto file_space = H5Dget_space(dset.getId());
+        check(H5Sselect_elements(file_space, H5S_SELECT_SET, n_selected, coords.data()),
+              "H5Sselect_elements");
+        auto count = hsize_t(n_selected);
+        auto mem_space = H5Screate_simple(1, &count, nullptr);
+        auto err = H5Dread(
+            dset.getId(), H5T_NATIVE_DOUBLE, mem_space, file_space, H5P_DEFAULT, values.data());
+        H5Sclose(mem_space);
+        H5Sclose(file_space);
+        check(err, "H5Dread");
+    });
+}
+
+void bench_product_set(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("ProductSet (row and column slices)");
+    if (!suite.isSelected(name)) {
+        return;
+    }
+
+    using Slice = std::array<size_t, 2>;
+    auto n_rows = n / n_cols;
+    auto dset = file.createDataSet<double>("product_set", DataSpace({n_rows, n_cols}));
+
+    // Every other block of 64 rows and two blocks of four columns.
+    auto row_slices = std::vector<Slice>{};
+    for (size_t i = 0; i + 64 <= n_rows; i += 128) {
+        row_slices.push_back({i, i + 64});
+    }
+    auto col_slices = std::vector<Slice>{{0, 4}, {8, 12}};
+    auto n_selected = row_slices.size() * 64 * 8;
+    auto values = iota(n_selected);
+    auto bytes = n_selected * sizeof(double);
+
+    auto raw_transfer = [&](bool is_read) {
+        auto file_space = H5Dget_space(dset.getId());
+        check(H5Sselect_none(file_space), "H5Sselect_none");
+        for (const auto& rows: row_slices) {
+            for (const auto& cols: col_slices) {
+                hsize_t offset[2] = {rows[0], cols[0]};
+                hsize_t count[2] = {rows[1] - rows[0], cols[1] - cols[0]};
+                auto err = H5Sselect_hyperslab(
+                    file_space, H5S_SELECT_OR, offset, nullptr, count, nullptr);
+                check(err, "H5Sselect_hyperslab");
+            }
+        }
+        auto count = hsize_t(n_selected);
+        auto mem_space = H5Screate_simple(1, &count, nullptr);
+        auto err = is_read ? H5Dread(dset.getId(),
+                                     H5T_NATIVE_DOUBLE,
+                                     mem_space,
+                                     file_space,
+                                     H5P_DEFAULT,
+                                     values.data())
+                           : H5Dwrite(dset.getId(),
+                                      H5T_NATIVE_DOUBLE,
+                                      mem_space,
+                                      file_space,
+                                      H5P_DEFAULT,
+                                      values.data());
+        H5Sclose(mem_space);
+        H5Sclose(file_space);
+        check(err, is_read ? "H5Dread" : "H5Dwrite");
+    };
+
+    // The selection is two-dimensional; hence, transfer a plain buffer.
+    suite.run(name, "write", "highfive", bytes, [&]() {
+        dset.select(ProductSet(row_slices, col_slices)).write_raw(values.data());
+    });
+    suite.run(name, "write", "hdf5", bytes, [&]() { raw_transfer(false); });
+    suite.run(name, "read", "highfive", bytes, [&]() {
+        dset.select(ProductSet(row_slices, col_slices)).read_raw(values.data());
+    });
+    suite.run(name, "read", "hdf5", bytes, [&]() { raw_transfer(true); });
+}
+
+// The time to construct a selection of rows and columns from lists of
+// indices, as a function of the number of indices; nothing is transferred.
+void bench_select_indices(bench::Suite& suite, File& file) {
+    const auto max_rows = size_t(100000);
+    auto dset = file.createDataSet<double>("select_indices", DataSpace({4 * max_rows, n_cols}));
+    auto cols = std::vector<size_t>{0, 1, 3, 4, 7, 9, 12, 15};
+
+    // Deterministic, sorted, pseudo-random rows; about one in four.
+    auto random_rows = [](size_t n_rows) {
+        auto rows = std::vector<size_t>{};
+        auto state = uint32_t(12345);
+        for (size_t i = 0; rows.size() < n_rows; ++i) {
+            state = state * 1664525u + 1013904223u;
+            if (state >> 30 == 0) {
+                rows.push_back(i);
+            }
+        }
+        return rows;
+    };
+
+    for (size_t n_rows = 100; n_rows <= max_rows; n_rows *= 10) {
+        auto consecutive = std::vector<size_t>(n_rows);
+        auto strided = std::vector<size_t>(n_rows);
+        for (size_t i = 0; i < n_rows; ++i) {
+            consecutive[i] = i;
+            strided[i] = 3 * i;
+        }
+        auto random = random_rows(n_rows);
+
+        auto run = [&](const std::string& pattern, const std::vector<size_t>& rows) {
+            auto name = "ProductSet (" + pattern + ", " + std::to_string(n_rows) + " rows)";
+            suite.run(name, "select", "highfive", 0, [&]() {
+                auto selection = dset.select(ProductSet(rows, cols));
+                (void) selection;
+            });
+        };
+
+        run("consecutive", consecutive);
+        run("strided", strided);
+        run("random", random);
+    }
+}
+
+void bench_attribute(bench::Suite& suite, File& file) {
+    auto name = std::string("Attribute std::vector<double> (16 elements)");
+    if (!suite.isSelected(name)) {
+        return;
+    }
+
+    auto values = iota(16);
+    auto bytes = values.size() * sizeof(double);
+    auto attr = file.createAttribute("attribute", values);
+
+    suite.run(name, "write", "highfive", bytes, [&]() { attr.write(values); });
+    suite.run(name, "write", "hdf5", bytes, [&]() {
+        check(H5Awrite(attr.getId(), H5T_NATIVE_DOUBLE, values.data()), "H5Awrite");
+    });
+    suite.run(name, "read", "highfive", bytes, [&]() { attr.read(values); });
+    suite.run(name, "read", "hdf5", bytes, [&]() {
+        check(H5Aread(attr.getId(), H5T_NATIVE_DOUBLE, values.data()), "H5Aread");
+    });
+}
+
+#ifdef HIGHFIVE_TEST_EIGEN
+void bench_eigen(bench::Suite& suite, File& file, size_t n) {
+    auto n_rows = n / n_cols;
+    auto raw = iota(n_rows * n_cols);
+    {
+        auto name = std::string("Eigen::Matrix (row-major)");
+        if (suite.isSelected(name)) {
+            using Matrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+            Matrix values = Matrix::Zero(Eigen::Index(n_rows), Eigen::Index(n_cols));
+            auto dset = file.createDataSet<double>("eigen_row_major", DataSpace({n_rows, n_cols}));
+            compare_dataset(suite, name, dset, values, raw, H5T_NATIVE_DOUBLE);
+        }
+    }
+    {
+        auto name = std::string("Eigen::MatrixXd (column-major)");
+        if (suite.isSelected(name)) {
+            Eigen::MatrixXd values = Eigen::MatrixXd::Zero(Eigen::Index(n_rows),
+                                                           Eigen::Index(n_cols));
+            auto dset = file.createDataSet<double>("eigen_col_major", DataSpace({n_rows, n_cols}));
+            compare_dataset(suite, name, dset, values, raw, H5T_NATIVE_DOUBLE);
+        }
+    }
+}
+#endif
+
+#ifdef HIGHFIVE_TEST_XTENSOR
+void bench_xtensor(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("xt::xtensor<double, 2>");
+    if (suite.isSelected(name)) {
+        auto n_rows = n / n_cols;
+        auto values = xt::xtensor<double, 2>::from_shape({n_rows, n_cols});
+        auto raw = iota(n_rows * n_cols);
+        auto dset = file.createDataSet<double>("xtensor", DataSpace({n_rows, n_cols}));
+        compare_dataset(suite, name, dset, values, raw, H5T_NATIVE_DOUBLE);
+    }
+}
+#endif
+
+#ifdef HIGHFIVE_TEST_MDSPAN
+void bench_mdspan(bench::Suite& suite, File& file, size_t n) {
+    auto name = std::string("std::mdspan<double, 2>");
+    if (suite.isSelected(name)) {
+        auto n_rows = n / n_cols;
+        auto storage = iota(n_rows * n_cols);
+        auto values = std::mdspan(storage.data(), std::dextents<size_t, 2>(n_rows, n_cols));
+        auto raw = iota(n_rows * n_cols);
+        auto dset = file.createDataSet<double>("mdspan", DataSpace({n_rows, n_cols}));
+        compare_dataset(suite, name, dset, values, raw, H5T_NATIVE_DOUBLE);
+    }
+}
+#endif
+
+std::string context_entry(const std::string& key, const std::string& value) {
+    return bench::Suite::quote(key) + ": " + bench::Suite::quote(value);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    auto options = bench::Options{};
+    auto output = std::string("highfive_benchmarks.json");
+    auto n = size_t(1) << 20;
+
+    for (int i = 1; i < argc; ++i) {
+        auto arg = std::string(argv[i]);
+        if (i + 1 == argc) {
+            std::cerr << "Missing value for '" << arg << "'.\n";
+            return 1;
+        }
+        if (arg == "--output") {
+            output = argv[++i];
+        } else if (arg == "--filter") {
+            options.filter = argv[++i];
+        } else if (arg == "--size") {
+            n = std::strtoul(argv[++i], nullptr, 10);
+        } else if (arg == "--repetitions") {
+            options.repetitions = std::max(size_t(1), size_t(std::strtoul(argv[++i], nullptr, 10)));
+        } else {
+            std::cerr << "Unknown argument '" << arg << "'.\n";
+            return 1;
+        }
+    }
+
+    auto suite = bench::Suite(options);
+    {
+        File file("highfive_benchmarks.h5", File::Truncate);
+
+        bench_vector(suite, file, n);
+        bench_nested_vector(suite, file, n);
+        bench_deeply_nested_vector(suite, file, n);
+        bench_array(suite, file, n);
+        bench_fixed_length_strings(suite, file, n);
+        bench_variable_length_strings(suite, file, n);
+        bench_compound(suite, file, n);
+        bench_element_set(suite, file, n);
+        bench_gather(suite, file, n);
+        bench_product_set(suite, file, n);
+        bench_select_indices(suite, file);
+        bench_attribute(suite, file);
+#ifdef HIGHFIVE_TEST_EIGEN
+        bench_eigen(suite, file, n);
+#endif
+#ifdef HIGHFIVE_TEST_XTENSOR
+        bench_xtensor(suite, file, n);
+#endif
+#ifdef HIGHFIVE_TEST_MDSPAN
+        bench_mdspan(suite, file, n);
+#endif
+    }
+
+    unsigned major = 0, minor = 0, release = 0;
+    H5get_libversion(&major, &minor, &release);
+    auto hdf5_version = std::to_string(major) + "." + std::to_string(minor) + "." +
+                        std::to_string(release);
+
+    char date[32] = {};
+    auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+
+    auto context = std::vector<std::string>{
+        context_entry("highfive_version", HIGHFIVE_VERSION_STRING),
+        context_entry("hdf5_version", hdf5_version),
+        context_entry("date", date),
+        bench::Suite::quote("elements") + ": " + std::to_string(n),
+        bench::Suite::quote("repetitions") + ": " + std::to_string(options.repetitions),
+    };
+
+    std::ofstream out(output);
+    suite.writeJSON(out, context);
+    if (!out) {
+        std::cerr << "Failed to write '" << output << "'.\n";
+        return 1;
+    }
+
+    return 0;
+}
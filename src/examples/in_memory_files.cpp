@@ -0,0 +1,51 @@
+/*
+ *  Copyright (c), 2022, Blue Brain Project
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include <highfive/highfive.hpp>
+
+using namespace HighFive;
+
+// Create an HDF5 file in memory, extract its bytes, e.g. to send them over
+// the network, and open those bytes as a file again.
+int main(void) {
+    const std::string dataset_name("dset");
+    auto data = std::vector<double>{1.0, 2.0, 3.0};
+
+    std::vector<std::uint8_t> buffer;
+    {
+        // The file only exists in memory, nothing is written to disk.
+        auto file = File::createInMemory();
+        file.createDataSet(dataset_name, data);
+
+        buffer = file.getImage();
+        std::cout << "Bytes in the image: " << buffer.size() << "\n";
+    }
+
+    // Open the buffer as a file, without copying it. The buffer must outlive
+    // the file.
+    auto h5 = File::fromImage(buffer.data(), buffer.size());
+
+    // Read a dataset as usual.
+    auto read_back = h5.getDataSet(dataset_name).read<std::vector<double>>();
+
+    // Check if the values match.
+    for (size_t i = 0; i < read_back.size(); ++i) {
+        if (read_back[i] != data[i]) {
+            throw std::runtime_error("Values don't match.");
+        } else {
+            std::cout << "read_back[" << i << "] = " << read_back[i] << "\n";
+        }
+    }
+
+    return 0;
+}
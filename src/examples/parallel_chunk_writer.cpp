@@ -0,0 +1,59 @@
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include <highfive/highfive.hpp>
+#include <highfive/parallel_chunks.hpp>
+
+// Compares the throughput of `DataSet::write` with writing the same
+// compressed dataset using a `ParallelChunkWriter`.
+//
+// Usage: parallel_chunk_writer_bin [n_rows] [n_threads]
+int main(int argc, char* argv[]) {
+    using namespace HighFive;
+
+    size_t n_rows = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4096;
+    size_t n_threads = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 0;
+    size_t n_cols = 4096;
+
+    // Smooth data with some noise compresses moderately, like most
+    // measurements do.
+    auto values = std::vector<float>(n_rows * n_cols);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::sin(0.001f * float(i)) + 1e-3f * float(i % 17);
+    }
+
+    auto props = DataSetCreateProps{};
+    props.add(Chunking({256, 256}));
+    props.add(Shuffle());
+    props.add(Deflate(6));
+
+    File file("parallel_chunk_writer.h5", File::Truncate);
+    auto dims = std::vector<size_t>{n_rows, n_cols};
+    auto serial = file.createDataSet<float>("serial", DataSpace(dims), props);
+    auto parallel = file.createDataSet<float>("parallel", DataSpace(dims), props);
+
+    auto measure = [](const std::function<void()>& f) {
+        auto start = std::chrono::steady_clock::now();
+        f();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count();
+    };
+
+    auto writer = ParallelChunkWriter(parallel, n_threads);
+
+    auto serial_seconds = measure([&]() { serial.write_raw(values.data()); });
+    auto parallel_seconds = measure([&]() { writer.write_raw(values.data()); });
+
+    auto mebibytes = double(values.size() * sizeof(float)) / (1024.0 * 1024.0);
+    std::cout << "size:               " << mebibytes << " MiB\n";
+    std::cout << "DataSet::write:     " << mebibytes / serial_seconds << " MiB/s\n";
+    std::cout << "ParallelChunkWriter (" << writer.getNumberThreads()
+              << " threads): " << mebibytes / parallel_seconds << " MiB/s\n";
+    std::cout << "speedup:            " << serial_seconds / parallel_seconds << "\n";
+
+    return 0;
+}
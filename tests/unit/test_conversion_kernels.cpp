@@ -0,0 +1,220 @@
+/*
+ *  Copyright (c), 2026, HighFive Developers
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+// The conversion kernels are compiled in only for this executable.
+#define HIGHFIVE_CONVERSION_KERNELS 1
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <highfive/highfive.hpp>
+
+using namespace HighFive;
+
+namespace {
+
+// Not a multiple of the block length of the kernels.
+const size_t n_values = 1000;
+
+std::vector<double> default_values() {
+    auto values = std::vector<double>(n_values);
+    for (size_t i = 0; i < n_values; ++i) {
+        auto sign = i % 2 == 0 ? 1.0 : -1.0;
+        values[i] = sign * double((i * 2654435761u) % 100003) / double(1 + i % 7);
+    }
+    // Too large for a `float`.
+    values[3] = 1e300;
+    values[4] = -1e300;
+    return values;
+}
+
+// Integers that a `float`, or a `double`, must round.
+template <class Int>
+std::vector<Int> large_integers() {
+    auto candidates = std::vector<int64_t>{16777217,
+                                           16777219,
+                                           -16777217,
+                                           (int64_t(1) << 53) + 1,
+                                           (int64_t(1) << 53) + 3,
+                                           -(int64_t(1) << 53) - 1,
+                                           (int64_t(1) << 62) + 1};
+    auto special = std::vector<Int>{std::numeric_limits<Int>::max(),
+                                    std::numeric_limits<Int>::max() - 1,
+                                    std::numeric_limits<Int>::min()};
+    for (auto c: candidates) {
+        if (c >= int64_t(std::numeric_limits<Int>::min()) &&
+            (c < 0 || uint64_t(c) <= uint64_t(std::numeric_limits<Int>::max()))) {
+            special.push_back(Int(c));
+        }
+    }
+
+    auto values = std::vector<Int>(n_values);
+    for (size_t i = 0; i < n_values; ++i) {
+        // Spread over all bits, including the lowest.
+        auto x = uint64_t(i + 1) * 0x9E3779B97F4A7C15u;
+        values[i] = i < special.size() ? special[i] : Int(x >> (i % 41));
+    }
+    return values;
+}
+
+// Creates a dataset of `file_type`, with `values` that HDF5 converted.
+template <class Source>
+DataSet create_dataset(File& file,
+                       const std::string& name,
+                       hid_t file_type,
+                       const std::vector<Source>& values) {
+    auto space = DataSpace({n_values});
+    auto dset_id =
+        H5Dcreate2(file.getId(), name.c_str(), file_type, space.getId(), H5P_DEFAULT, H5P_DEFAULT,
+                   H5P_DEFAULT);
+    REQUIRE(dset_id >= 0);
+    auto mem_datatype = AtomicType<Source>();
+    REQUIRE(H5Dwrite(dset_id, mem_datatype.getId(), H5S_ALL, H5S_ALL, H5P_DEFAULT,
+                     values.data()) >= 0);
+    H5Dclose(dset_id);
+
+    return file.getDataSet(name);
+}
+
+std::string next_name() {
+    static size_t n_datasets = 0;
+    return "dset" + std::to_string(n_datasets++);
+}
+
+std::vector<uint8_t> read_bytes(const DataSet& dset) {
+    auto datatype = dset.getDataType();
+    auto bytes = std::vector<uint8_t>(dset.getElementCount() * datatype.getSize());
+    dset.read_raw(bytes.data(), datatype);
+    return bytes;
+}
+
+// Compares reading and writing `Mem` with and without the kernels.
+template <class Mem, class Source = double>
+void check_conversion(File& file,
+                      hid_t file_type,
+                      bool has_kernel,
+                      const std::vector<Source>& initial = default_values()) {
+    auto name = next_name();
+    auto dset = create_dataset(file, name, file_type, initial);
+    auto mem_datatype = AtomicType<Mem>();
+
+    auto kernel = details::find_conversion_kernel(dset.getDataType(), mem_datatype);
+    CHECK((kernel != nullptr) == has_kernel);
+
+    // `read_raw` always uses HDF5's conversion.
+    auto expected = std::vector<Mem>(n_values);
+    dset.read_raw(expected.data(), mem_datatype);
+
+    auto transfer_buffer = TransferBuffer();
+    auto values = std::vector<Mem>{};
+    dset.read(values, transfer_buffer);
+    CHECK(values == expected);
+    CHECK(transfer_buffer.getStagedBytes() ==
+          (has_kernel ? n_values * dset.getDataType().getSize() : 0));
+
+    auto part = dset.select({10}, {500}).template read<std::vector<Mem>>();
+    CHECK(part == std::vector<Mem>(expected.begin() + 10, expected.begin() + 510));
+
+    // Write the values back, once with and once without the kernels.
+    auto converted = create_dataset(file, name + "_converted", file_type, initial);
+    converted.write(values);
+    auto reference = create_dataset(file, name + "_reference", file_type, initial);
+    reference.write_raw(values.data(), mem_datatype);
+    CHECK(read_bytes(converted) == read_bytes(reference));
+}
+
+}  // namespace
+
+TEST_CASE("ConversionKernels") {
+    File file("conversion_kernels.h5", File::Truncate);
+
+    // Byte swaps.
+    check_conversion<double>(file, H5T_IEEE_F64BE, true);
+    check_conversion<float>(file, H5T_IEEE_F32BE, true);
+    check_conversion<int16_t>(file, H5T_STD_I16BE, true);
+    check_conversion<int32_t>(file, H5T_STD_I32BE, true);
+    check_conversion<uint64_t>(file, H5T_STD_U64BE, true);
+
+    // Floats.
+    check_conversion<float>(file, H5T_IEEE_F64LE, true);
+    check_conversion<float>(file, H5T_IEEE_F64BE, true);
+    check_conversion<double>(file, H5T_IEEE_F32LE, true);
+
+    // Integers to larger integers and to floats.
+    check_conversion<int32_t>(file, H5T_STD_I16LE, true);
+    check_conversion<int64_t>(file, H5T_STD_I16BE, true);
+    check_conversion<int16_t>(file, H5T_STD_U8LE, true);
+    check_conversion<uint32_t>(file, H5T_STD_U8LE, true);
+    check_conversion<int64_t>(file, H5T_STD_I32BE, true);
+    check_conversion<double>(file, H5T_STD_I64LE, true);
+    check_conversion<float>(file, H5T_STD_U64BE, true);
+
+    // Integers that must be rounded.
+    check_conversion<float>(file, H5T_STD_I64BE, true, large_integers<int64_t>());
+    check_conversion<double>(file, H5T_STD_I64BE, true, large_integers<int64_t>());
+    check_conversion<float>(file, H5T_STD_U64BE, true, large_integers<uint64_t>());
+    check_conversion<double>(file, H5T_STD_U64BE, true, large_integers<uint64_t>());
+    check_conversion<float>(file, H5T_STD_I64LE, true, large_integers<int64_t>());
+    check_conversion<double>(file, H5T_STD_U64LE, true, large_integers<uint64_t>());
+    check_conversion<float>(file, H5T_STD_I32BE, true, large_integers<int32_t>());
+
+    // Left to HDF5.
+    check_conversion<double>(file, H5T_IEEE_F64LE, false);
+    check_conversion<int32_t>(file, H5T_STD_I64LE, false);
+    check_conversion<uint32_t>(file, H5T_STD_I16LE, false);
+    check_conversion<int32_t>(file, H5T_IEEE_F64LE, false);
+    check_conversion<long double>(file, H5T_IEEE_F64LE, false);
+}
+
+TEST_CASE("ConversionKernelsNested") {
+    File file("conversion_kernels_nested.h5", File::Truncate);
+
+    // The nested vector is staged, the conversion doesn't use the
+    // `TransferBuffer` then.
+    using nested_type = std::vector<std::vector<float>>;
+    auto values = std::vector<std::vector<double>>(20, std::vector<double>(7));
+    for (size_t i = 0; i < values.size(); ++i) {
+        for (size_t j = 0; j < values[i].size(); ++j) {
+            values[i][j] = 0.25 * double(7 * i + j);
+        }
+    }
+    auto dset = file.createDataSet("nested", values);
+
+    auto transfer_buffer = TransferBuffer();
+    auto nested = nested_type{};
+    dset.read(nested, transfer_buffer);
+    for (size_t i = 0; i < values.size(); ++i) {
+        for (size_t j = 0; j < values[i].size(); ++j) {
+            CHECK(nested[i][j] == float(values[i][j]));
+        }
+    }
+
+    dset.write(nested);
+    CHECK(dset.read<std::vector<std::vector<double>>>() == values);
+}
+
+TEST_CASE("ConversionKernelsLargeSelection") {
+    File file("conversion_kernels_large.h5", File::Truncate);
+
+    // Too large to be staged, HDF5 converts the values.
+    auto n = details::max_conversion_staging_bytes / sizeof(double) + 1;
+    auto values = std::vector<double>(n, 0.5);
+    auto dset = file.createDataSet("large", values);
+
+    auto transfer_buffer = TransferBuffer();
+    auto converted = std::vector<float>{};
+    dset.read(converted, transfer_buffer);
+    CHECK(converted == std::vector<float>(n, 0.5f));
+    CHECK(transfer_buffer.getStagedBytes() == 0);
+}
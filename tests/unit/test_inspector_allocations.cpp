@@ -0,0 +1,115 @@
+/*
+ *  Copyright (c), 2026, HighFive Developers
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <highfive/highfive.hpp>
+
+// Counts the heap allocations of the entire executable, hence these tests
+// live in their own executable.
+static std::atomic<size_t> n_allocations{0};
+
+void* operator new(std::size_t size) {
+    ++n_allocations;
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /* size */) noexcept {
+    std::free(ptr);
+}
+
+using namespace HighFive;
+
+// A view of a temporary vector would dangle.
+static_assert(std::is_convertible<const std::vector<size_t>&, details::dims_view>::value,
+              "dims_view views a vector");
+static_assert(!std::is_convertible<std::vector<size_t>, details::dims_view>::value,
+              "dims_view doesn't view a temporary vector");
+
+namespace {
+
+using nested_type = std::vector<std::vector<std::vector<double>>>;
+
+nested_type make_nested(size_t n, size_t m, size_t k) {
+    auto values = nested_type(n, std::vector<std::vector<double>>(m, std::vector<double>(k)));
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < m; ++j) {
+            for (size_t l = 0; l < k; ++l) {
+                values[i][j][l] = double((i * m + j) * k + l);
+            }
+        }
+    }
+    return values;
+}
+
+// Number of allocations made by `f`.
+template <class F>
+size_t count_allocations(F&& f) {
+    auto before = n_allocations.load();
+    f();
+    return n_allocations.load() - before;
+}
+
+}  // namespace
+
+TEST_CASE("Nested inspectors don't allocate", "[inspector]") {
+    using inspector = details::inspector<nested_type>;
+
+    size_t n = 100, m = 50, k = 3;
+    auto values = make_nested(n, m, k);
+    auto dims = std::vector<size_t>{n, m, k};
+    auto buffer = std::vector<double>(n * m * k);
+
+    CHECK(count_allocations([&]() { inspector::serialize(values, dims, buffer.data()); }) == 0);
+    CHECK(buffer[(17 * m + 3) * k + 2] == values[17][3][2]);
+
+    auto actual = make_nested(n, m, k);
+    for (auto& x: buffer) {
+        x += 1.0;
+    }
+
+    CHECK(count_allocations([&]() { inspector::prepare(actual, dims); }) == 0);
+    CHECK(count_allocations([&]() { inspector::unserialize(buffer.data(), dims, actual); }) == 0);
+    CHECK(actual[17][3][2] == values[17][3][2] + 1.0);
+}
+
+TEST_CASE("Allocations per row when reading nested vectors", "[inspector]") {
+    auto file = File("inspector_allocations.h5", File::Truncate);
+
+    size_t m = 8, k = 4;
+    auto count_read = [&](size_t n) {
+        auto values = make_nested(n, m, k);
+        auto dset = file.createDataSet("x" + std::to_string(n), values);
+
+        auto actual = make_nested(n, m, k);
+        auto n_read = count_allocations([&]() { dset.read(actual); });
+        CHECK(actual == values);
+        return n_read;
+    };
+
+    // Allocations for the intermediate buffer and the dataspaces, but none
+    // per row.
+    auto n_small = count_read(10);
+    auto n_large = count_read(10000);
+    CHECK(n_large == n_small);
+}
@@ -0,0 +1,182 @@
+/*
+ *  Copyright (c), 2026, HighFive Developers
+ *
+ *  Distributed under the Boost Software License, Version 1.0.
+ *    (See accompanying file LICENSE_1_0.txt or copy at
+ *          http://www.boost.org/LICENSE_1_0.txt)
+ *
+ */
+
+// The instrumentation is compiled in only for this executable.
+#define HIGHFIVE_INSTRUMENTATION 1
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <highfive/highfive.hpp>
+
+using namespace HighFive;
+
+TEST_CASE("Instrumentation", "[instrumentation]") {
+    auto& instrumentation = get_global_instrumentation();
+    instrumentation.reset();
+
+    auto events = std::vector<IOEvent>{};
+    register_instrumentation_callback([&events](const IOEvent& event) { events.push_back(event); });
+
+    {
+        File file("instrumentation.h5", File::Truncate);
+        auto values = std::vector<double>{1.0, 2.0, 3.0};
+        auto dset = file.createGroup("g").createDataSet("x", values);
+
+        auto nested = std::vector<std::vector<double>>{{1.0, 2.0}, {3.0, 4.0}};
+        file.createDataSet("nested", nested);
+
+        auto strings = std::vector<std::string>{"a", "bcd"};
+        file.createDataSet("strings", strings);
+
+        auto attr = dset.createAttribute("scale", 2.0);
+        CHECK(file.getDataSet("/g/x").read<std::vector<float>>().size() == 3);
+        CHECK(file.getDataSet("nested").read<std::vector<std::vector<double>>>() == nested);
+        CHECK(attr.read<double>() == 2.0);
+
+        double raw[3];
+        dset.read_raw(raw);
+        file.flush();
+    }
+    register_instrumentation_callback(nullptr);
+
+    auto snapshot = instrumentation.snapshot();
+
+    CHECK(snapshot.at("instrumentation.h5").at(IOOperation::Create).n_calls == 1);
+    CHECK(snapshot.at("instrumentation.h5").at(IOOperation::Flush).n_calls == 1);
+    CHECK(snapshot.at("/g").at(IOOperation::Create).n_calls == 1);
+
+    const auto& x = snapshot.at("/g/x");
+    CHECK(x.at(IOOperation::Create).n_calls == 1);
+    CHECK(x.at(IOOperation::Open).n_calls == 1);
+    CHECK(x.at(IOOperation::Write).n_calls == 1);
+    CHECK(x.at(IOOperation::Write).bytes == 3 * sizeof(double));
+    CHECK(x.at(IOOperation::Write).staged_bytes == 0);
+    CHECK(x.at(IOOperation::Write).n_conversions == 0);
+
+    // Once as `float`, which requires a conversion, once as `double`.
+    CHECK(x.at(IOOperation::Read).n_calls == 2);
+    CHECK(x.at(IOOperation::Read).bytes == 3 * sizeof(float) + 3 * sizeof(double));
+    CHECK(x.at(IOOperation::Read).n_conversions == 1);
+
+    const auto& nested = snapshot.at("/nested");
+    CHECK(nested.at(IOOperation::Write).staged_bytes == 4 * sizeof(double));
+    CHECK(nested.at(IOOperation::Read).staged_bytes == 4 * sizeof(double));
+
+    // The array of `char*` passed to HDF5.
+    CHECK(snapshot.at("/strings").at(IOOperation::Write).staged_bytes == 2 * sizeof(char*));
+
+    const auto& scale = snapshot.at("/g/x@scale");
+    CHECK(scale.at(IOOperation::Write).n_calls == 1);
+    CHECK(scale.at(IOOperation::Read).bytes == sizeof(double));
+
+    size_t n_events = 0;
+    for (const auto& object: snapshot) {
+        for (const auto& operation: object.second) {
+            n_events += operation.second.n_calls;
+        }
+    }
+    CHECK(events.size() == n_events);
+    CHECK(events.front().operation == IOOperation::Create);
+    CHECK(events.front().thread_id == std::this_thread::get_id());
+
+    instrumentation.reset();
+    CHECK(instrumentation.snapshot().empty());
+}
+
+TEST_CASE("ChromeTracer", "[instrumentation]") {
+    std::string filename = "instrumentation.trace.json";
+    size_t n_events = 0;
+    {
+        ChromeTracer tracer(filename);
+
+        File file("instrumentation_trace.h5", File::Truncate);
+        using nested_type = std::vector<std::vector<double>>;
+        auto nested = nested_type{{1.0, 2.0}, {3.0, 4.0}};
+        auto dset = file.createDataSet("nested", nested);
+        CHECK(dset.select({1, 0}, {1, 2}).read<nested_type>()[0][1] == 4.0);
+
+        std::thread([&file]() { file.getDataSet("nested").read<nested_type>(); }).join();
+        file.flush();
+
+        n_events = tracer.getNumberOfEvents();
+    }
+
+    std::ifstream in(filename);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    auto trace = buffer.str();
+
+    auto count = [&trace](const std::string& s) {
+        size_t n = 0;
+        for (auto pos = trace.find(s); pos != std::string::npos; pos = trace.find(s, pos + 1)) {
+            ++n;
+        }
+        return n;
+    };
+
+    CHECK(trace.rfind("{\"traceEvents\":[", 0) == 0);
+    CHECK(trace.substr(trace.size() - 3) == "]}\n");
+    CHECK(count("\"ph\":\"X\"") == n_events);
+
+    for (auto name: {"create", "open", "select", "serialize", "unserialize", "write", "read"}) {
+        CHECK(count(std::string("{\"name\":\"") + name + "\"") > 0);
+    }
+    CHECK(count("{\"name\":\"flush\"") == 1);
+    CHECK(count("\"path\":\"/nested\"") > 0);
+    CHECK(count("\"bytes\":16") > 0);
+
+    // Open, read and unserialize on the second thread.
+    CHECK(count("\"tid\":1,") > 0);
+    CHECK(count("\"tid\":2,") == 3);
+}
+
+TEST_CASE("ChromeTracerSeveral", "[instrumentation]") {
+    File file("instrumentation_tracers.h5", File::Truncate);
+    auto dset = file.createDataSet("x", std::vector<double>{1.0, 2.0, 3.0});
+
+    ChromeTracer first("instrumentation_first.trace.json");
+    {
+        ChromeTracer second("instrumentation_second.trace.json");
+        dset.read<std::vector<double>>();
+        CHECK(second.getNumberOfEvents() == first.getNumberOfEvents());
+    }
+
+    // Destroying the second tracer doesn't stop the first one.
+    auto n_events = first.getNumberOfEvents();
+    dset.read<std::vector<double>>();
+    CHECK(first.getNumberOfEvents() > n_events);
+}
+
+TEST_CASE("ChromeTracerConcurrentDestruction", "[instrumentation]") {
+    File file("instrumentation_concurrent.h5", File::Truncate);
+    auto dset = file.createDataSet("x", std::vector<double>{1.0, 2.0, 3.0});
+
+    // Tracers are destroyed while another thread records events.
+    std::atomic<bool> is_done{false};
+    auto reader = std::thread([&dset, &is_done]() {
+        while (!is_done) {
+            dset.read<std::vector<double>>();
+        }
+    });
+
+    for (size_t i = 0; i < 20; ++i) {
+        ChromeTracer tracer("instrumentation_concurrent.trace.json");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    is_done = true;
+    reader.join();
+}
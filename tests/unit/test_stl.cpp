@@ -56,3 +56,38 @@ TEST_CASE("T[n][m]") {
         testing::compare_arrays(expected, x, {n, m});
     }
 }
+
+TEST_CASE("uninitialized_vector", "[stl]") {
+    auto file = File("rw_uninitialized_vector.h5", File::Truncate);
+
+    auto expected = testing::DataGenerator<std::vector<std::vector<int>>>::create({4, 7});
+    auto dset = file.createDataSet("x", expected);
+
+    SECTION("1D") {
+        auto flat = std::vector<int>{};
+        for (const auto& row: expected) {
+            flat.insert(flat.end(), row.begin(), row.end());
+        }
+        auto x = file.createDataSet("flat", flat);
+
+        auto actual = x.read<uninitialized_vector<int>>();
+        CHECK(std::vector<int>(actual.begin(), actual.end()) == flat);
+
+        auto preallocated = uninitialized_vector<int>(3, 42);
+        CHECK(preallocated == uninitialized_vector<int>{42, 42, 42});
+        x.read(preallocated);
+        CHECK(preallocated.size() == flat.size());
+        CHECK(std::vector<int>(preallocated.begin(), preallocated.end()) == flat);
+    }
+
+    SECTION("2D") {
+        auto actual = dset.read<uninitialized_vector<uninitialized_vector<int>>>();
+        REQUIRE(actual.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            CHECK(std::vector<int>(actual[i].begin(), actual[i].end()) == expected[i]);
+        }
+
+        auto y = file.createDataSet("y", actual);
+        CHECK(y.read<std::vector<std::vector<int>>>() == expected);
+    }
+}
@@ -13,10 +13,14 @@
 #include <cstring>
 #include <ctime>
 #include <iostream>
+#include <limits>
 #include <map>
 #include <memory>
+#include <new>
+#include <numeric>
 #include <random>
 #include <string>
+#include <thread>
 #include <typeinfo>
 #include <type_traits>
 #include <vector>
@@ -26,6 +30,7 @@
 #include <catch2/matchers/catch_matchers_vector.hpp>
 
 #include <highfive/highfive.hpp>
+#include <highfive/async_io.hpp>
 #include "tests_high_five.hpp"
 #include "create_traits.hpp"
 
@@ -37,6 +42,13 @@
 #include <highfive/eigen.hpp>
 #endif
 
+#ifdef HIGHFIVE_TEST_ZLIB
+#include <highfive/parallel_chunks.hpp>
+#endif
+
+#include <highfive/direct_reader.hpp>
+#include <highfive/gather_reader.hpp>
+
 #ifdef HIGHFIVE_TEST_SPAN
 #include <highfive/span.hpp>
 #endif
@@ -1053,6 +1065,297 @@ TEST_CASE("ChunkingConstructorsTest") {
     CHECK(third_res == third_ans);
 }
 
+TEST_CASE("DataSet::chunks") {
+    const std::string file_name("test_chunk_range.h5");
+    File file(file_name, File::Truncate);
+
+    size_t n_rows = 10, n_cols = 7;
+    auto values = std::vector<std::vector<int>>(n_rows, std::vector<int>(n_cols));
+    for (size_t i = 0; i < n_rows; ++i) {
+        std::iota(values[i].begin(), values[i].end(), int(i * n_cols));
+    }
+
+    auto props = DataSetCreateProps{};
+    props.add(Chunking({3, 2}));
+    auto dset = file.createDataSet<int>("dset", DataSpace({n_rows, n_cols}), props);
+    dset.write(values);
+
+    auto check_covers = [&](const ChunkRange& range) {
+        auto visited = std::vector<std::vector<int>>(n_rows, std::vector<int>(n_cols, 0));
+        for (auto it = range.begin(); it != range.end(); ++it) {
+            auto offset = it.getOffset();
+            auto count = it.getCount();
+            auto block = (*it).read<std::vector<std::vector<int>>>();
+
+            REQUIRE(block.size() == count[0]);
+            for (size_t i = 0; i < count[0]; ++i) {
+                REQUIRE(block[i].size() == count[1]);
+                for (size_t j = 0; j < count[1]; ++j) {
+                    CHECK(block[i][j] == values[offset[0] + i][offset[1] + j]);
+                    visited[offset[0] + i][offset[1] + j] += 1;
+                }
+            }
+        }
+
+        for (const auto& row: visited) {
+            CHECK(row == std::vector<int>(n_cols, 1));
+        }
+    };
+
+    SECTION("one chunk per step") {
+        auto range = dset.chunks();
+        CHECK(range.getChunkDimensions() == std::vector<size_t>{3, 2});
+        CHECK(range.getBlockDimensions() == std::vector<size_t>{3, 2});
+        CHECK(range.size() == 16);
+        CHECK(range.getMaxElementCount() == 6);
+        CHECK(range.getOffset(5) == std::vector<size_t>{3, 2});
+        CHECK(range.getCount(15) == std::vector<size_t>{1, 1});
+        check_covers(range);
+    }
+
+    SECTION("several chunks per step") {
+        CHECK(dset.chunks(3).getBlockDimensions() == std::vector<size_t>{3, 6});
+        CHECK(dset.chunks(3).size() == 8);
+        CHECK(dset.chunks(4).getBlockDimensions() == std::vector<size_t>{3, 8});
+        CHECK(dset.chunks(4).size() == 4);
+        CHECK(dset.chunks(8).getBlockDimensions() == std::vector<size_t>{6, 8});
+        CHECK(dset.chunks(8).size() == 2);
+        CHECK(dset.chunks(100).size() == 1);
+
+        check_covers(dset.chunks(3));
+        check_covers(dset.chunks(8));
+    }
+
+    SECTION("contiguous") {
+        auto contiguous = file.createDataSet("contiguous", values);
+        CHECK_THROWS_AS(contiguous.chunks(), DataSetException);
+    }
+}
+
+#if H5_VERSION_GE(1, 10, 5)
+TEST_CASE("DirectChunkIO") {
+    const std::string file_name("test_direct_chunk_io.h5");
+    File file(file_name, File::Truncate);
+
+    size_t n_rows = 8, n_cols = 6;
+    auto values = std::vector<std::vector<int>>(n_rows, std::vector<int>(n_cols));
+    for (size_t i = 0; i < n_rows; ++i) {
+        std::iota(values[i].begin(), values[i].end(), int(i * n_cols));
+    }
+
+    auto props = DataSetCreateProps{};
+    props.add(Chunking({4, 3}));
+    props.add(Deflate(6));
+
+    auto source = file.createDataSet<int>("source", DataSpace({n_rows, n_cols}), props);
+    auto target = file.createDataSet<int>("target", DataSpace({n_rows, n_cols}), props);
+    source.write(values);
+
+    SECTION("list chunks") {
+        CHECK(source.getNumberChunks() == 4);
+        CHECK(target.getNumberChunks() == 0);
+
+        auto chunks = source.listChunks();
+        REQUIRE(chunks.size() == 4);
+        CHECK(chunks[0].offset == std::vector<size_t>{0, 0});
+        CHECK(chunks[3].offset == std::vector<size_t>{4, 3});
+
+        auto info = source.getChunkInfo({4, 0});
+        CHECK(info.size == source.getChunkStorageSize({4, 0}));
+        CHECK(info.size > 0);
+        CHECK(info.size < 4 * 3 * sizeof(int));
+        CHECK(info.address == source.getChunkInfoByIndex(2).address);
+
+        CHECK(target.getChunkInfo({4, 0}).size == 0);
+    }
+
+    SECTION("copy raw chunks") {
+        auto buffer = std::vector<uint8_t>{};
+        for (const auto& info: source.listChunks()) {
+            auto filter_mask = source.readChunk(info.offset, buffer);
+            CHECK(filter_mask == info.filter_mask);
+            CHECK(buffer.size() == info.size);
+            target.writeChunk(info.offset, buffer, filter_mask);
+        }
+
+        CHECK(target.read<std::vector<std::vector<int>>>() == values);
+    }
+
+    SECTION("write unfiltered chunk") {
+        auto raw = file.createDataSet<int>("raw", DataSpace({n_rows, n_cols}), [] {
+            auto raw_props = DataSetCreateProps{};
+            raw_props.add(Chunking({4, 3}));
+            return raw_props;
+        }());
+
+        auto chunk = std::vector<int>(4 * 3);
+        std::iota(chunk.begin(), chunk.end(), 100);
+        raw.writeChunk({4, 3}, chunk.data(), chunk.size() * sizeof(int));
+
+        auto block = raw.select({4, 3}, {4, 3}).read<std::vector<std::vector<int>>>();
+        CHECK(block[0] == std::vector<int>{100, 101, 102});
+        CHECK(block[3] == std::vector<int>{109, 110, 111});
+    }
+}
+#endif
+
+#if defined(HIGHFIVE_TEST_ZLIB) && H5_VERSION_GE(1, 10, 5)
+TEST_CASE("ParallelChunkWriter") {
+    const std::string file_name("test_parallel_chunk_writer.h5");
+    File file(file_name, File::Truncate);
+
+    // Neither axis is a multiple of the chunk size, i.e. there are edge chunks.
+    size_t n_rows = 37, n_cols = 23;
+    auto values = std::vector<std::vector<float>>(n_rows, std::vector<float>(n_cols));
+    for (size_t i = 0; i < n_rows; ++i) {
+        for (size_t j = 0; j < n_cols; ++j) {
+            values[i][j] = float(i % 7) * 0.5f + float(j);
+        }
+    }
+
+    auto props = DataSetCreateProps{};
+    props.add(Chunking({8, 5}));
+    props.add(Shuffle());
+    props.add(Deflate(6));
+
+    auto expected = file.createDataSet<float>("expected", DataSpace({n_rows, n_cols}), props);
+    auto actual = file.createDataSet<float>("actual", DataSpace({n_rows, n_cols}), props);
+    expected.write(values);
+
+    SECTION("byte-compatible with the filter pipeline") {
+        auto writer = ParallelChunkWriter(actual, 3);
+        CHECK(writer.getNumberThreads() == 3);
+        writer.write(values);
+
+        CHECK(actual.read<std::vector<std::vector<float>>>() == values);
+
+        auto expected_chunks = expected.listChunks();
+        REQUIRE(actual.getNumberChunks() == expected_chunks.size());
+
+        auto expected_bytes = std::vector<uint8_t>{};
+        auto actual_bytes = std::vector<uint8_t>{};
+        for (const auto& info: expected_chunks) {
+            expected.readChunk(info.offset, expected_bytes);
+            CHECK(actual.readChunk(info.offset, actual_bytes) == 0);
+            CHECK(actual_bytes == expected_bytes);
+        }
+    }
+
+    SECTION("write_raw") {
+        auto flat = std::vector<float>{};
+        for (const auto& row: values) {
+            flat.insert(flat.end(), row.begin(), row.end());
+        }
+
+        auto writer = ParallelChunkWriter(actual);
+        writer.write_raw(flat.data());
+        CHECK(actual.read<std::vector<std::vector<float>>>() == values);
+    }
+
+    SECTION("mismatching datatype") {
+        auto writer = ParallelChunkWriter(actual, 2);
+        auto doubles = std::vector<std::vector<double>>(n_rows, std::vector<double>(n_cols));
+        CHECK_THROWS_AS(writer.write(doubles), DataTypeException);
+    }
+
+    SECTION("contiguous dataset") {
+        auto contiguous = file.createDataSet<float>("contiguous", DataSpace({n_rows, n_cols}));
+        CHECK_THROWS_AS(ParallelChunkWriter(contiguous), DataSetException);
+    }
+}
+#endif
+
+#if defined(HIGHFIVE_TEST_ZLIB) && H5_VERSION_GE(1, 10, 5)
+TEST_CASE("ParallelChunkReader") {
+    const std::string file_name("test_parallel_chunk_reader.h5");
+    File file(file_name, File::Truncate);
+
+    size_t n_rows = 37, n_cols = 23;
+    auto values = std::vector<std::vector<float>>(n_rows, std::vector<float>(n_cols));
+    for (size_t i = 0; i < n_rows; ++i) {
+        for (size_t j = 0; j < n_cols; ++j) {
+            values[i][j] = float(i * n_cols + j);
+        }
+    }
+
+    auto props = DataSetCreateProps{};
+    props.add(Chunking({8, 5}));
+    props.add(Shuffle());
+    props.add(Deflate(6));
+
+    auto dset = file.createDataSet<float>("dset", DataSpace({n_rows, n_cols}), props);
+    dset.write(values);
+
+    auto reader = ParallelChunkReader(dset, 3);
+
+    SECTION("entire dataset") {
+        auto actual = std::vector<std::vector<float>>{};
+        reader.read(actual);
+        CHECK(actual == values);
+
+        auto flat = std::vector<float>(n_rows * n_cols);
+        reader.read_raw(flat.data());
+        CHECK(flat[5 * n_cols + 7] == values[5][7]);
+        CHECK(flat.back() == values.back().back());
+    }
+
+    SECTION("strided hyperslab") {
+        auto slab = HyperSlab(RegularHyperSlab({1, 2}, {5, 3}, {7, 6}, {3, 4}));
+        auto expected = dset.select(slab).read<std::vector<float>>();
+        REQUIRE(expected.size() == 5 * 3 * 3 * 4);
+
+        auto actual = std::vector<float>{};
+        reader.read(dset.select(slab), actual);
+        CHECK(actual == expected);
+    }
+
+    SECTION("union of blocks") {
+        auto slab = HyperSlab(RegularHyperSlab({2, 1}, {10, 4})) |
+                    RegularHyperSlab({5, 10}, {20, 9}) | RegularHyperSlab({30, 0}, {1, 23});
+        auto expected = dset.select(slab).read<std::vector<float>>();
+
+        auto actual = std::vector<float>(expected.size());
+        reader.read_raw(dset.select(slab), actual.data());
+        CHECK(actual == expected);
+    }
+
+    SECTION("three dimensions") {
+        auto props_3d = DataSetCreateProps{};
+        props_3d.add(Chunking({3, 4, 5}));
+        props_3d.add(Deflate(6));
+
+        auto flat_values = std::vector<float>(7 * 9 * 11);
+        std::iota(flat_values.begin(), flat_values.end(), 0.0f);
+        auto dset_3d = file.createDataSet<float>("dset_3d", DataSpace({7, 9, 11}), props_3d);
+        dset_3d.write_raw(flat_values.data());
+
+        auto slab = HyperSlab(RegularHyperSlab({0, 1, 0}, {3, 2, 2}, {2, 4, 6}, {2, 2, 3})) |
+                    RegularHyperSlab({1, 0, 3}, {5, 9, 2});
+        auto expected = dset_3d.select(slab).read<std::vector<float>>();
+
+        auto actual = std::vector<float>{};
+        ParallelChunkReader(dset_3d, 2).read(dset_3d.select(slab), actual);
+        CHECK(actual == expected);
+    }
+
+    SECTION("unallocated chunks") {
+        auto sparse = file.createDataSet<float>("sparse", DataSpace({n_rows, n_cols}), props);
+        sparse.select({9, 6}, {3, 3}).write(std::vector<std::vector<float>>(3, {1, 2, 3}));
+
+        auto expected = sparse.read<std::vector<std::vector<float>>>();
+        auto actual = std::vector<std::vector<float>>{};
+        ParallelChunkReader(sparse).read(actual);
+        CHECK(actual == expected);
+    }
+
+    SECTION("point selection") {
+        auto actual = std::vector<float>{};
+        CHECK_THROWS_AS(reader.read(dset.select(ElementSet({0, 0, 1, 1})), actual),
+                        DataSpaceException);
+    }
+}
+#endif
+
 TEST_CASE("HighFiveReadWriteShortcut") {
     std::ostringstream filename;
     filename << "h5_rw_vec_shortcut_test.h5";
@@ -1494,6 +1797,54 @@ TEST_CASE("productSet") {
         dset.select(ProductSet(yslices, xslices)).read(subarray);
         check(array, subarray, yslices, xslices);
     }
+
+    SECTION("strided PP") {
+        std::vector<std::vector<double>> subarray;
+
+        auto ypoints = Points{0, 2, 4, 5};
+        auto xpoints = Points{1, 3, 4, 6, 7, 9, 10, 11};
+        auto yslices = Slices{{0, 1}, {2, 3}, {4, 6}};
+        auto xslices = Slices{{1, 2}, {3, 5}, {6, 8}, {9, 12}};
+
+        dset.select(ProductSet(ypoints, xpoints)).read(subarray);
+        check(array, subarray, yslices, xslices);
+    }
+}
+
+TEST_CASE("AxisSelection") {
+    using detail::AxisSelection;
+
+    auto compile = [](const std::vector<size_t>& ids) {
+        AxisSelection axis;
+        for (auto id: ids) {
+            axis.add(id);
+        }
+
+        auto flat = std::vector<size_t>{};
+        for (const auto& g: axis.compile()) {
+            flat.insert(flat.end(), {g.offset, g.count, g.stride, g.block});
+        }
+        return flat;
+    };
+
+    CHECK(compile({}).empty());
+    CHECK(compile({4}) == std::vector<size_t>{4, 1, 1, 1});
+    CHECK(compile({2, 3, 4, 5}) == std::vector<size_t>{2, 1, 1, 4});
+    CHECK(compile({1, 4, 7, 10}) == std::vector<size_t>{1, 4, 3, 1});
+    CHECK(compile({0, 1, 5, 6, 10, 11}) == std::vector<size_t>{0, 3, 5, 2});
+    CHECK(compile({0, 2, 4, 5, 9}) == std::vector<size_t>{0, 2, 2, 1, 4, 1, 1, 2, 9, 1, 1, 1});
+
+    AxisSelection slices;
+    slices.add(0, 3);
+    slices.add(3, 5);
+    slices.add(7, 7);
+    slices.add(10, 15);
+    auto groups = slices.compile();
+    REQUIRE(groups.size() == 1);
+    CHECK(groups[0].offset == 0);
+    CHECK(groups[0].count == 2);
+    CHECK(groups[0].stride == 10);
+    CHECK(groups[0].block == 5);
 }
 
 
@@ -2367,6 +2718,882 @@ TEST_CASE("HighFiveIntegerType") {
     }
 }
 
+TEST_CASE("TransferBuffer") {
+    const std::string file_name("test_transfer_buffer.h5");
+    File file(file_name, File::Truncate);
+
+    size_t n_rows = 10, n_cols = 7;
+    auto values = std::vector<std::vector<double>>(n_rows, std::vector<double>(n_cols));
+    for (size_t i = 0; i < n_rows; ++i) {
+        std::iota(values[i].begin(), values[i].end(), double(i * n_cols));
+    }
+
+    auto dset = file.createDataSet<double>("dset", DataSpace({n_rows, n_cols}));
+    auto block_bytes = 2 * n_cols * sizeof(double);
+
+    SECTION("reuse") {
+        auto transfer_buffer = TransferBuffer();
+        dset.write(values, transfer_buffer);
+        CHECK(transfer_buffer.getAllocationCount() == 1);
+        CHECK(transfer_buffer.getStagedBytes() == n_rows * n_cols * sizeof(double));
+
+        transfer_buffer.resetStatistics();
+        auto block = std::vector<std::vector<double>>{};
+        for (size_t i = 0; i + 2 <= n_rows; i += 2) {
+            dset.select({i, 0}, {2, n_cols}).read(block, transfer_buffer);
+            CHECK(block[0] == values[i]);
+            CHECK(block[1] == values[i + 1]);
+        }
+
+        CHECK(transfer_buffer.getAllocationCount() == 0);
+        CHECK(transfer_buffer.getStagedBytes() == (n_rows / 2) * block_bytes);
+    }
+
+    SECTION("preallocated") {
+        auto transfer_buffer = TransferBuffer(block_bytes);
+        CHECK(transfer_buffer.capacity() >= block_bytes);
+        CHECK(transfer_buffer.getAllocationCount() == 1);
+
+        auto block = std::vector<std::vector<double>>{values[3], values[4]};
+        dset.select({3, 0}, {2, n_cols}).write(block, transfer_buffer);
+        CHECK(transfer_buffer.getAllocationCount() == 1);
+
+        dset.select({3, 0}, {2, n_cols}).read(block, transfer_buffer);
+        CHECK(block[0] == values[3]);
+        CHECK(transfer_buffer.getAllocationCount() == 1);
+
+        // A failed allocation keeps the old memory.
+        auto capacity = transfer_buffer.capacity();
+        CHECK_THROWS_AS(transfer_buffer.reserve(std::numeric_limits<size_t>::max() / 2),
+                        std::bad_alloc);
+        CHECK(transfer_buffer.capacity() == capacity);
+        dset.select({3, 0}, {2, n_cols}).read(block, transfer_buffer);
+        CHECK(block[1] == values[4]);
+
+        transfer_buffer.release();
+        CHECK(transfer_buffer.capacity() == 0);
+    }
+
+    SECTION("trivially copyable") {
+        auto transfer_buffer = TransferBuffer();
+        dset.write(values, transfer_buffer);
+        transfer_buffer.resetStatistics();
+
+        auto row = std::vector<double>{};
+        dset.select({1, 0}, {1, n_cols}).squeezeMemSpace({0}).read(row, transfer_buffer);
+        CHECK(row == values[1]);
+        CHECK(transfer_buffer.getStagedBytes() == 0);
+    }
+}
+
+TEST_CASE("Appender") {
+    const std::string file_name("test_appender.h5");
+    File file(file_name, File::Truncate);
+
+    auto props = DataSetCreateProps{};
+    props.add(Chunking({4, 3}));
+
+    auto unlimited = DataSpace({0, 3}, {DataSpace::UNLIMITED, 3});
+    auto dset = file.createDataSet<int>("dset", unlimited, props);
+
+    auto make_row = [](size_t i) {
+        return std::array<int, 3>{int(3 * i), int(3 * i + 1), int(3 * i + 2)};
+    };
+
+    SECTION("batches") {
+        auto appender = dset.appender<std::array<int, 3>>(6);
+        CHECK(appender.getBatchRows() == 8);
+
+        for (size_t i = 0; i < 7; ++i) {
+            appender.append(make_row(i));
+        }
+        CHECK(appender.getBufferedRows() == 7);
+        CHECK(dset.getDimensions()[0] == 0);
+
+        appender.append(make_row(7));
+        CHECK(appender.getBufferedRows() == 0);
+        CHECK(appender.capacity() == 8);
+
+        for (size_t i = 8; i < 19; ++i) {
+            appender.append(make_row(i));
+        }
+        CHECK(appender.size() == 19);
+        CHECK(appender.capacity() == 16);
+
+        appender.flush();
+        CHECK(dset.getDimensions() == std::vector<size_t>{19, 3});
+
+        auto rows = dset.read<std::vector<std::array<int, 3>>>();
+        for (size_t i = 0; i < rows.size(); ++i) {
+            CHECK(rows[i] == make_row(i));
+        }
+    }
+
+    SECTION("existing rows") {
+        dset.resize({5, 3});
+        dset.write(std::vector<std::array<int, 3>>{make_row(0),
+                                                   make_row(1),
+                                                   make_row(2),
+                                                   make_row(3),
+                                                   make_row(4)});
+
+        {
+            auto appender = Appender<std::vector<int>>(dset);
+            auto rows = std::vector<std::vector<int>>{};
+            for (size_t i = 5; i < 30; ++i) {
+                auto row = make_row(i);
+                rows.emplace_back(row.begin(), row.end());
+            }
+            appender.append(rows.begin(), rows.end());
+
+            auto moved = std::move(appender);
+            CHECK(moved.size() == 30);
+        }
+
+        CHECK(dset.getDimensions() == std::vector<size_t>{30, 3});
+        auto rows = dset.read<std::vector<std::vector<int>>>();
+        for (size_t i = 0; i < rows.size(); ++i) {
+            auto row = make_row(i);
+            CHECK(rows[i] == std::vector<int>(row.begin(), row.end()));
+        }
+    }
+
+    SECTION("one-dimensional") {
+        auto values_props = DataSetCreateProps{};
+        values_props.add(Chunking({16}));
+        auto values = file.createDataSet<double>("values",
+                                                 DataSpace({0}, {DataSpace::UNLIMITED}),
+                                                 values_props);
+        auto appender = values.appender<double>();
+        for (size_t i = 0; i < 100; ++i) {
+            appender.append(double(i));
+        }
+        appender.flush();
+
+        auto expected = std::vector<double>(100);
+        std::iota(expected.begin(), expected.end(), 0.0);
+        CHECK(values.read<std::vector<double>>() == expected);
+    }
+
+    SECTION("errors") {
+        auto appender = dset.appender<std::vector<int>>();
+        CHECK_THROWS_AS(appender.append(std::vector<int>{1, 2}), DataSpaceException);
+
+        auto bounded = file.createDataSet<int>("bounded", DataSpace({0, 3}, {5, 3}), props);
+        auto bounded_appender = bounded.appender<std::array<int, 3>>();
+        for (size_t i = 0; i < 5; ++i) {
+            bounded_appender.append(make_row(i));
+        }
+        bounded_appender.flush();
+        CHECK(bounded.getDimensions()[0] == 5);
+
+        bounded_appender.append(make_row(5));
+        CHECK_THROWS_AS(bounded_appender.flush(), DataSetException);
+
+        auto contiguous = file.createDataSet<int>("contiguous", DataSpace({4, 3}));
+        CHECK_THROWS_AS((contiguous.appender<std::array<int, 3>>()), DataSetException);
+
+        // The rank of a row doesn't match the dataset.
+        CHECK_THROWS_AS(dset.appender<int>(), DataSpaceException);
+        CHECK_THROWS_AS(dset.appender<std::vector<std::vector<int>>>(), DataSpaceException);
+    }
+}
+
+TEST_CASE("AsyncIO") {
+    const std::string file_name("test_async_io.h5");
+    File file(file_name, File::Truncate);
+
+    size_t n_rows = 6, n_cols = 5;
+    auto values = std::vector<std::vector<int>>(n_rows, std::vector<int>(n_cols));
+    for (size_t i = 0; i < n_rows; ++i) {
+        std::iota(values[i].begin(), values[i].end(), int(i * n_cols));
+    }
+
+    auto dset = file.createDataSet<int>("dset", DataSpace({n_rows, n_cols}));
+
+    SECTION("owned buffer") {
+        auto buffer = values;
+        auto written = writeAsync(dset, std::move(buffer));
+        auto read = readAsync<std::vector<std::vector<int>>>(dset);
+
+        written.get();
+        CHECK(read.get() == values);
+    }
+
+    SECTION("borrowed buffer") {
+        writeAsync(dset, std::cref(values)).get();
+
+        auto row = std::vector<int>{};
+        auto read = readAsync(dset.select({2, 0}, {1, n_cols}).squeezeMemSpace({0}), row);
+        read.get();
+        CHECK(row == values[2]);
+    }
+
+    SECTION("ordered") {
+        auto n_requests = 4 * AsyncIOQueue::getDefault().getCapacity();
+        auto futures = std::vector<std::future<void>>{};
+        for (size_t k = 0; k < n_requests; ++k) {
+            auto row = std::vector<int>(n_cols, int(k));
+            auto row_selection = dset.select({k % n_rows, 0}, {1, n_cols}).squeezeMemSpace({0});
+            futures.push_back(writeAsync(row_selection, std::move(row)));
+        }
+        AsyncIOQueue::getDefault().wait();
+        CHECK(AsyncIOQueue::getDefault().size() == 0);
+
+        auto expected = std::vector<int>(n_cols, int(n_requests - 1));
+        auto last = (n_requests - 1) % n_rows;
+        CHECK(readAsync<std::vector<std::vector<int>>>(dset).get()[last] == expected);
+    }
+
+    SECTION("attribute") {
+        auto attr = dset.createAttribute<double>("scale", DataSpace::From(2.5));
+        writeAsync(attr, 2.5).get();
+        CHECK(readAsync<double>(attr).get() == 2.5);
+
+        auto scale = 0.0;
+        readAsync(attr, scale).get();
+        CHECK(scale == 2.5);
+    }
+
+    SECTION("exception") {
+        auto written = writeAsync(dset, std::vector<int>(n_rows * n_cols + 1));
+        CHECK_THROWS_AS(written.get(), DataSpaceException);
+
+        auto read = readAsync<std::vector<std::vector<std::vector<int>>>>(dset);
+        CHECK_THROWS_AS(read.get(), DataSpaceException);
+    }
+
+    SECTION("lock") {
+        auto read = readAsync<std::vector<std::vector<int>>>(dset);
+        {
+            auto hdf5_lock = AsyncIOQueue::lock();
+            CHECK(dset.getDimensions() == std::vector<size_t>{n_rows, n_cols});
+        }
+        read.get();
+    }
+}
+
+TEST_CASE("HandleCache") {
+    File file("handle_cache.h5", File::Truncate);
+    file.createDataSet("g/x", std::vector<int>{1, 2, 3});
+    file.createDataSet("y", 4.0);
+
+    SECTION("disabled") {
+        CHECK(file.getDataSet("g/x").read<std::vector<int>>() == std::vector<int>{1, 2, 3});
+        CHECK(file.getHandleCacheHits() == 0);
+        CHECK(file.getHandleCacheMisses() == 0);
+    }
+
+    file.enableHandleCache(2);
+
+    SECTION("hits") {
+        auto x = file.getDataSet("g/x");
+        CHECK(file.getHandleCacheMisses() == 1);
+        CHECK(file.getHandleCacheHits() == 0);
+
+        auto x_again = file.getDataSet("/g/x");
+        CHECK(x_again == x);
+        CHECK(x_again.read<std::vector<int>>() == std::vector<int>{1, 2, 3});
+        CHECK(file.getHandleCacheHits() == 1);
+
+        CHECK(file.exist("/g/x"));
+        CHECK(file.getObjectType("g/x") == ObjectType::Dataset);
+        CHECK(file.getHandleCacheHits() == 3);
+
+        auto g = file.getGroup("g");
+        CHECK(g.getPath() == "/g");
+        CHECK(file.getGroup("/g") == g);
+        CHECK(file.getHandleCacheHits() == 4);
+
+        // Wrong type, not served from the cache.
+        CHECK_THROWS_AS(file.getGroup("g/x"), GroupException);
+        CHECK(file.getHandleCacheMisses() == 3);
+    }
+
+    SECTION("eviction") {
+        file.getDataSet("g/x");
+        file.getDataSet("y");
+        file.getGroup("g");
+        file.getDataSet("y");
+        CHECK(file.getHandleCacheHits() == 1);
+        file.getDataSet("g/x");
+        CHECK(file.getHandleCacheHits() == 1);
+        CHECK(file.getHandleCacheMisses() == 4);
+    }
+
+    SECTION("invalidation") {
+        file.getDataSet("g/x");
+        file.unlink("g/x");
+        CHECK(!file.exist("g/x"));
+        CHECK_THROWS_AS(file.getDataSet("g/x"), DataSetException);
+
+        file.createDataSet("g/x", std::vector<int>{4, 5});
+        CHECK(file.getDataSet("g/x").read<std::vector<int>>() == std::vector<int>{4, 5});
+
+        file.rename("g", "h");
+        CHECK(!file.exist("g/x"));
+        CHECK(file.getDataSet("h/x").read<std::vector<int>>() == std::vector<int>{4, 5});
+
+        file.getGroup("h");
+        file.unlink("h");
+        file.createDataSet("h", 1.0);
+        CHECK(file.getObjectType("h") == ObjectType::Dataset);
+    }
+
+    SECTION("copies") {
+        auto copy = file;
+        copy.getDataSet("y");
+        file.getDataSet("y");
+        CHECK(file.getHandleCacheHits() == 1);
+
+        file.disableHandleCache();
+        file.getDataSet("y");
+        CHECK(file.getHandleCacheHits() == 0);
+        CHECK(copy.getHandleCacheHits() == 1);
+    }
+}
+
+TEST_CASE("FileImage") {
+    auto values = std::vector<double>{1.0, 2.0, 3.0};
+
+    auto image = std::vector<uint8_t>{};
+    {
+        auto file = File::createInMemory();
+        CHECK(CoreDriver(file.getAccessPropertyList()).hasBackingStore() == false);
+
+        file.createDataSet("x", values);
+        file.createGroup("g").createAttribute("a", 42);
+
+        image = file.getImage();
+        CHECK(image.size() == file.getImageSize());
+
+        auto too_small = std::vector<uint8_t>(image.size() - 1);
+        CHECK_THROWS_AS(file.getImage(too_small.data(), too_small.size()), FileException);
+    }
+    auto original = image;
+
+    SECTION("read-only, without copying") {
+        auto file = File::fromImage(image.data(), image.size());
+        CHECK(file.getDataSet("x").read<std::vector<double>>() == values);
+        CHECK(file.getGroup("g").getAttribute("a").read<int>() == 42);
+
+        // Both files are open at the same time.
+        auto other = File::fromImage(image.data(), image.size());
+        CHECK(other.getName() != file.getName());
+        CHECK(other.exist("x"));
+
+        auto copy = std::vector<uint8_t>(file.getImageSize());
+        CHECK(file.getImage(copy.data(), copy.size()) == copy.size());
+        CHECK(File::fromImage(copy.data(), copy.size()).exist("g"));
+    }
+
+    SECTION("read-write") {
+        {
+            auto file = File::fromImage(image.data(), image.size(), File::ReadWrite);
+            file.getDataSet("x").write(std::vector<double>{4.0, 5.0, 6.0});
+            file.createDataSet("y", std::vector<int>(1000, 7));
+
+            auto modified = file.getImage();
+            auto reopened = File::fromImage(modified.data(), modified.size());
+            CHECK(reopened.getDataSet("y").read<std::vector<int>>().size() == 1000);
+            CHECK(reopened.getDataSet("x").read<std::vector<double>>()[0] == 4.0);
+        }
+
+        // The caller's buffer is left untouched.
+        CHECK(image == original);
+    }
+
+    SECTION("from a file on disk") {
+        const std::string file_name("file_image.h5");
+        {
+            File file(file_name, File::Truncate);
+            file.createDataSet("z", values);
+        }
+
+        auto disk_image = File(file_name).getImage();
+        auto file = File::fromImage(disk_image.data(), disk_image.size());
+        CHECK(file.getDataSet("z").read<std::vector<double>>() == values);
+    }
+}
+
+#if HIGHFIVE_HAS_POSIX_IO
+TEST_CASE("MappedArray") {
+    const std::string file_name("mapped_array.h5");
+    size_t n = 100, m = 7;
+    auto values = std::vector<std::vector<double>>(n, std::vector<double>(m));
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < m; ++j) {
+            values[i][j] = double(i * m + j);
+        }
+    }
+
+    MappedArray<double> mapped;
+    {
+        File file(file_name, File::Truncate);
+        auto dset = file.createDataSet("x", values);
+        file.createDataSet<int>("empty", DataSpace({0}));
+
+        // Written, but not yet flushed.
+        mapped = dset.map<double>();
+
+        DataSetCreateProps props;
+        props.add(Chunking(std::vector<hsize_t>{10, 7}));
+        auto chunked = file.createDataSet("chunked", values, props);
+        CHECK_THROWS_AS(chunked.map<double>(), DataSetException);
+
+        CHECK_THROWS_AS(dset.map<float>(), DataSetException);
+        CHECK_THROWS_AS(dset.map<int64_t>(), DataSetException);
+
+        auto unallocated = file.createDataSet<double>("unallocated", DataSpace({n}));
+        CHECK_THROWS_AS(unallocated.map<double>(), DataSetException);
+
+        CHECK(file.getDataSet("empty").map<int>().empty());
+    }
+
+    // The mapping outlives the file.
+    CHECK(mapped.getDimensions() == std::vector<size_t>{n, m});
+    REQUIRE(mapped.size() == n * m);
+    CHECK(mapped[m + 2] == values[1][2]);
+    CHECK(mapped(17, 3) == values[17][3]);
+    CHECK(std::equal(mapped.begin(), mapped.end(), mapped.data()));
+    CHECK(*(mapped.end() - 1) == values[n - 1][m - 1]);
+
+    auto moved = std::move(mapped);
+    CHECK(mapped.empty());
+    CHECK(moved(n - 1, m - 1) == values[n - 1][m - 1]);
+
+    File file(file_name, File::ReadOnly);
+    auto reopened = file.getDataSet("x").map<double>();
+    CHECK(std::equal(reopened.begin(), reopened.end(), moved.begin()));
+}
+
+TEST_CASE("DirectReader") {
+    const std::string file_name("direct_reader.h5");
+    File file(file_name, File::Truncate);
+
+    size_t n_rows = 37, n_cols = 23;
+    auto values = std::vector<std::vector<double>>(n_rows, std::vector<double>(n_cols));
+    for (size_t i = 0; i < n_rows; ++i) {
+        for (size_t j = 0; j < n_cols; ++j) {
+            values[i][j] = double(i * n_cols + j);
+        }
+    }
+
+    auto contiguous = file.createDataSet("contiguous", values);
+
+    auto props = DataSetCreateProps{};
+    props.add(Chunking({8, 5}));
+    auto chunked = file.createDataSet<double>("chunked", DataSpace({n_rows, n_cols}), props);
+    chunked.write(values);
+
+    // Only some chunks are allocated, the others read as the fill value.
+    auto sparse = file.createDataSet<double>("sparse", DataSpace({n_rows, n_cols}), props);
+    sparse.select({9, 6}, {3, 3}).write(std::vector<std::vector<double>>(3, {1, 2, 3}));
+
+    for (const auto& name: {"contiguous", "chunked", "sparse"}) {
+        DYNAMIC_SECTION(name) {
+            auto dset = file.getDataSet(name);
+            auto expected = dset.read<std::vector<std::vector<double>>>();
+            auto reader = DirectReader<double>(dset);
+            CHECK(reader.getDimensions() == std::vector<size_t>{n_rows, n_cols});
+
+            auto actual = std::vector<std::vector<double>>{};
+            reader.read(actual);
+            CHECK(actual == expected);
+
+            auto block = std::vector<double>(4 * 7);
+            reader.read_raw({9, 4}, {4, 7}, block.data());
+            CHECK(block[0] == expected[9][4]);
+            CHECK(block[3 * 7 + 6] == expected[12][10]);
+
+            auto slab = HyperSlab(RegularHyperSlab({1, 2}, {5, 3}, {7, 6}, {3, 4})) |
+                        RegularHyperSlab({30, 0}, {1, 23});
+            auto flat = std::vector<double>{};
+            reader.read(dset.select(slab), flat);
+            CHECK(flat == dset.select(slab).read<std::vector<double>>());
+
+            auto product = ProductSet(std::vector<size_t>{0, 3, 4, 30},
+                                      std::array<size_t, 2>{2, 9});
+            using rows_type = std::vector<std::vector<double>>;
+            auto rows = rows_type{};
+            reader.read(dset.select(product), rows);
+            CHECK(rows == dset.select(product).read<rows_type>());
+
+            // Every other row and column, one block per element.
+            auto even_rows = std::vector<size_t>{};
+            for (size_t i = 0; i < n_rows; i += 2) {
+                even_rows.push_back(i);
+            }
+            auto even_cols = std::vector<size_t>{};
+            for (size_t j = 0; j < n_cols; j += 2) {
+                even_cols.push_back(j);
+            }
+            auto grid = ProductSet(even_rows, even_cols);
+            reader.read(dset.select(grid), rows);
+            CHECK(rows == dset.select(grid).read<rows_type>());
+
+            CHECK_THROWS_AS(reader.read_raw({30, 20}, {8, 1}, block.data()), DataSpaceException);
+        }
+    }
+
+    SECTION("concurrent") {
+        auto reader = DirectReader<double>(chunked);
+        auto actual = std::vector<double>(n_rows * n_cols);
+
+        auto threads = std::vector<std::thread>{};
+        for (size_t t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t]() {
+                for (size_t i = t; i < n_rows; i += 4) {
+                    reader.read_raw({i, 0}, {1, n_cols}, actual.data() + i * n_cols);
+                }
+            });
+        }
+        for (auto& thread: threads) {
+            thread.join();
+        }
+
+        for (size_t i = 0; i < n_rows; ++i) {
+            CHECK(std::equal(values[i].begin(), values[i].end(), actual.data() + i * n_cols));
+        }
+    }
+
+    SECTION("unsupported") {
+        CHECK_THROWS_AS(DirectReader<float>(contiguous), DataTypeException);
+
+        auto filtered_props = DataSetCreateProps{};
+        filtered_props.add(Chunking({8, 5}));
+        filtered_props.add(Shuffle());
+        auto filtered = file.createDataSet("filtered", values, filtered_props);
+        CHECK_THROWS_AS(DirectReader<double>(filtered), DataSetException);
+
+        CHECK_THROWS_AS(DirectReader<double>(file.createDataSet("scalar", 1.0)),
+                        DataSetException);
+    }
+}
+#endif
+
+TEST_CASE("GatherReader") {
+    const std::string file_name("gather_reader.h5");
+    File file(file_name, File::Truncate);
+
+    size_t n = 100, m = 8;
+    auto values = std::vector<std::vector<int>>(n, std::vector<int>(m));
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < m; ++j) {
+            values[i][j] = int(i * m + j);
+        }
+    }
+
+    auto props = DataSetCreateProps{};
+    props.add(Chunking({10, 8}));
+    props.add(Deflate(6));
+    auto chunked = file.createDataSet("chunked", values, props);
+    auto contiguous = file.createDataSet("contiguous", values);
+
+    // Unsorted, with repetitions; touches the chunks 9, 0, 5 and 3.
+    auto coordinates = std::vector<size_t>{95, 1, 3, 7, 4, 4, 55, 0, 95, 1, 3, 7, 31, 5, 99, 7};
+    auto n_points = coordinates.size() / 2;
+    auto expected = std::vector<double>(n_points);
+    for (size_t p = 0; p < n_points; ++p) {
+        expected[p] = double(coordinates[2 * p] * m + coordinates[2 * p + 1]);
+    }
+
+    SECTION("chunked") {
+        auto reader = GatherReader<double>(chunked);
+        CHECK(reader.read(ElementSet(coordinates)) == expected);
+        // One read for each of the chunks 0 and 9; one for the other points.
+        CHECK(reader.getNumberOfReads() == 3);
+        CHECK(chunked.select(ElementSet(coordinates)).read<std::vector<double>>() == expected);
+    }
+
+    SECTION("contiguous") {
+        // Tiles of four elements.
+        auto reader = GatherReader<double>(contiguous, 4 * sizeof(double));
+        CHECK(reader.getMaxStagingBytes() == 4 * sizeof(double));
+
+        auto actual = std::vector<double>(n_points);
+        reader.read_raw(coordinates.data(), n_points, actual.data());
+        CHECK(actual == expected);
+        // One read each for the repeated (95, 1) and (3, 7); the four
+        // isolated points are one batch.
+        CHECK(reader.getNumberOfReads() == 3);
+    }
+
+    SECTION("errors") {
+        auto reader = GatherReader<int>(chunked);
+        CHECK_THROWS_AS(reader.read(ElementSet({100, 0})), DataSpaceException);
+        CHECK_THROWS_AS(reader.read(ElementSet({1, 2, 3})), DataSpaceException);
+        CHECK(reader.read(ElementSet(std::vector<size_t>{})).empty());
+        CHECK_THROWS_AS(GatherReader<int>(file.createDataSet("scalar", 1)), DataSetException);
+    }
+}
+
+TEST_CASE("MultiTransfer") {
+    const std::string file_name("multi_transfer.h5");
+    File file(file_name, File::Truncate);
+
+    size_t n = 10, m = 3;
+    auto x = std::vector<double>(n);
+    auto ids = std::vector<std::vector<int>>(n, std::vector<int>(m));
+    auto names = std::vector<std::string>(n);
+    for (size_t i = 0; i < n; ++i) {
+        x[i] = 0.5 * double(i);
+        for (size_t j = 0; j < m; ++j) {
+            ids[i][j] = int(m * i + j);
+        }
+        names[i] = "name-" + std::to_string(i);
+    }
+
+    auto dset_x = file.createDataSet<double>("x", DataSpace::From(x));
+    auto dset_ids = file.createDataSet<int>("ids", DataSpace::From(ids));
+    auto dset_names = file.createDataSet<std::string>("names", DataSpace::From(names));
+
+    auto partial = std::vector<std::string>(3, "partial");
+    auto more = std::vector<std::string>(7, "more");
+
+    auto transfer = MultiTransfer();
+    transfer.write(dset_x, x);
+    transfer.write(dset_ids, ids);
+    transfer.write(dset_names.select({0}, {3}), partial);
+    transfer.write(dset_names.select({3}, {7}), more);
+    CHECK(transfer.size() == 4);
+    transfer.execute();
+    CHECK(transfer.empty());
+
+    auto expected_names = std::vector<std::string>(n);
+    std::fill(expected_names.begin(), expected_names.begin() + 3, "partial");
+    std::fill(expected_names.begin() + 3, expected_names.end(), "more");
+    CHECK(dset_x.read<std::vector<double>>() == x);
+    CHECK(dset_ids.read<std::vector<std::vector<int>>>() == ids);
+    CHECK(dset_names.read<std::vector<std::string>>() == expected_names);
+
+    // Reads and writes are issued in order. Repeated datasets are issued in
+    // separate calls.
+    auto x_read = std::vector<double>{};
+    auto ids_read = std::vector<std::vector<int>>{};
+    auto names_read = std::vector<std::string>{};
+    auto x_tail = std::vector<double>{};
+    transfer.write(dset_names, names);
+    transfer.read(dset_x, x_read);
+    transfer.read(dset_ids, ids_read);
+    transfer.read(dset_names, names_read);
+    transfer.read(dset_x.select({7}, {3}), x_tail);
+    transfer.execute();
+
+    CHECK(x_read == x);
+    CHECK(ids_read == ids);
+    CHECK(names_read == names);
+    CHECK(x_tail == std::vector<double>(x.begin() + 7, x.end()));
+
+    CHECK_THROWS_AS(transfer.write(dset_ids, x), DataSpaceException);
+    CHECK(transfer.empty());
+
+    // The last write to a dataset wins, also within one call to `execute`.
+    auto halves = std::vector<double>(n, 0.5);
+    auto thirds = std::vector<double>(3, 1.0 / 3.0);
+    transfer.write(dset_x, halves);
+    transfer.write(dset_ids, ids);
+    transfer.write(dset_x.select({0}, {3}), thirds);
+    transfer.write(dset_x.select({2}, {3}), thirds);
+    transfer.execute();
+
+    auto expected_x = halves;
+    std::fill(expected_x.begin(), expected_x.begin() + 5, 1.0 / 3.0);
+    CHECK(dset_x.read<std::vector<double>>() == expected_x);
+    CHECK(dset_ids.read<std::vector<std::vector<int>>>() == ids);
+
+    // A read queued before a write sees the old values.
+    auto before = std::vector<double>{};
+    auto after = std::vector<double>{};
+    transfer.read(dset_x, before);
+    transfer.write(dset_x, x);
+    transfer.read(dset_x, after);
+    transfer.execute();
+    CHECK(before == expected_x);
+    CHECK(after == x);
+}
+
+TEST_CASE("MultiTransferFailure") {
+    const std::string file_name("multi_transfer_failure.h5");
+    const std::string read_only_name("multi_transfer_read_only.h5");
+
+    auto names = std::vector<std::string>{"a", "bb", "ccc"};
+    {
+        File read_only(read_only_name, File::Truncate);
+        read_only.createDataSet("x", std::vector<double>{1.0, 2.0});
+    }
+
+    File file(file_name, File::Truncate);
+    auto dset_names = file.createDataSet("names", names);
+    auto read_only = File(read_only_name, File::ReadOnly);
+    auto dset_read_only = read_only.getDataSet("x");
+
+    // The reads before the failing write are complete.
+    auto names_read = std::vector<std::string>{};
+    auto values = std::vector<double>{3.0, 4.0};
+    auto transfer = MultiTransfer();
+    transfer.read(dset_names, names_read);
+    transfer.write(dset_read_only, values);
+    CHECK_THROWS_AS(transfer.execute(), DataSetException);
+    CHECK(transfer.empty());
+    CHECK(names_read == names);
+}
+
+TEST_CASE("MultiTransferSeveralFiles") {
+    auto file_a = File("multi_transfer_a.h5", File::Truncate);
+    auto file_b = File("multi_transfer_b.h5", File::Truncate);
+
+    size_t n = 5;
+    auto values = std::vector<std::vector<int>>(4, std::vector<int>(n));
+    for (size_t k = 0; k < values.size(); ++k) {
+        std::iota(values[k].begin(), values[k].end(), int(10 * k));
+    }
+
+    // Datasets of both files are interleaved, and both files have a dataset
+    // called "x"; on HDF5 1.14 this results in several calls to
+    // `H5Dwrite_multi` and `H5Dread_multi`.
+    auto datasets = std::vector<DataSet>{
+        file_a.createDataSet<int>("x", DataSpace(n)),
+        file_a.createDataSet<int>("y", DataSpace(n)),
+        file_b.createDataSet<int>("x", DataSpace(n)),
+        file_a.createDataSet<int>("z", DataSpace(n)),
+    };
+
+    auto transfer = MultiTransfer();
+    for (size_t k = 0; k < datasets.size(); ++k) {
+        transfer.write(datasets[k], values[k]);
+    }
+    transfer.execute();
+
+    auto read_back = std::vector<std::vector<int>>(datasets.size());
+    for (size_t k = 0; k < datasets.size(); ++k) {
+        transfer.read(datasets[k], read_back[k]);
+    }
+    transfer.execute();
+
+    CHECK(read_back == values);
+    CHECK(file_a.getDataSet("x").read<std::vector<int>>() == values[0]);
+    CHECK(file_b.getDataSet("x").read<std::vector<int>>() == values[2]);
+}
+
+TEST_CASE("CompiledSelection") {
+    const std::string file_name("compiled_selection.h5");
+    File file(file_name, File::Truncate);
+
+    size_t n = 20, m = 6;
+    auto datasets = std::vector<DataSet>{};
+    for (size_t k = 0; k < 3; ++k) {
+        auto values = std::vector<std::vector<double>>(n, std::vector<double>(m));
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < m; ++j) {
+                values[i][j] = double(100 * k + 10 * i + j);
+            }
+        }
+        datasets.push_back(file.createDataSet("dset" + std::to_string(k), values));
+    }
+
+    auto rows = std::vector<size_t>{1, 2, 5, 8, 11, 19};
+    auto cols = std::vector<size_t>{0, 3, 4};
+    auto compiled = CompiledSelection(datasets[0].select(ProductSet(rows, cols)));
+    CHECK(compiled.getDimensions() == std::vector<size_t>{n, m});
+    CHECK(compiled.getMemSpace().getDimensions() == std::vector<size_t>{rows.size(), cols.size()});
+
+    for (const auto& dset: datasets) {
+        auto selection = compiled.bind(dset);
+        CHECK(selection.getDataset().getPath() == dset.getPath());
+        // No new dataspace was created.
+        CHECK(selection.getSpace().getId() == compiled.getSpace().getId());
+
+        using rows_type = std::vector<std::vector<double>>;
+        auto expected = dset.select(ProductSet(rows, cols)).read<rows_type>();
+        CHECK(selection.read<rows_type>() == expected);
+    }
+
+    auto other = file.createDataSet<double>("other", DataSpace({m, n}));
+    CHECK_THROWS_AS(compiled.bind(other), DataSpaceException);
+}
+
+TEST_CASE("StringTable") {
+    const std::string file_name("string_table.h5");
+    File file(file_name, File::Truncate);
+
+    // Long enough to need several blocks of the arena.
+    size_t n = 10000;
+    auto values = std::vector<std::string>(n);
+    for (size_t i = 0; i < n; ++i) {
+        values[i] = i % 7 == 0 ? std::string() : "identifier-" + std::to_string(i * i);
+    }
+    values[1] = std::string(100000, 'x');
+
+    auto check_table = [](const StringTable& table, const std::vector<std::string>& expected) {
+        REQUIRE(table.size() == expected.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            CHECK(table.str(i) == expected[i]);
+            CHECK(table.length(i) == expected[i].size());
+            CHECK(table.c_str(i)[table.length(i)] == '\0');
+        }
+        CHECK(table.offsets().back() == table.chars().size());
+    };
+
+    SECTION("variable length") {
+        auto dset = file.createDataSet("vlen", values);
+
+        auto table = StringTable();
+        dset.read(table);
+        check_table(table, values);
+        CHECK(table.getDimensions() == std::vector<size_t>{n});
+        CHECK(table.c_str(0) + 1 == table.c_str(1));
+#if HIGHFIVE_CXX_STD >= 17
+        CHECK(table[2] == values[2]);
+#endif
+
+        // Reusing the table for a selection.
+        dset.select({10}, {5}).read(table);
+        check_table(table, std::vector<std::string>(values.begin() + 10, values.begin() + 15));
+        CHECK(table.getDimensions() == std::vector<size_t>{5});
+
+        auto other = dset.read<StringTable>(DataTransferProps{});
+        check_table(other, values);
+    }
+
+    SECTION("two-dimensional") {
+        auto grid = std::vector<std::vector<std::string>>{{"a", "bb", ""}, {"dddd", "e", "ff"}};
+        auto dset = file.createDataSet("grid", grid);
+
+        auto table = dset.read<StringTable>();
+        check_table(table, {"a", "bb", "", "dddd", "e", "ff"});
+        CHECK(table.getDimensions() == std::vector<size_t>{2, 3});
+    }
+
+    SECTION("fixed length") {
+        auto short_values = std::vector<std::string>{"abc", "", "abcdefg"};
+        auto dims = std::vector<size_t>{short_values.size()};
+
+        auto null_terminated = file.createDataSet(
+            "null_terminated",
+            DataSpace(dims),
+            FixedLengthStringType(8, StringPadding::NullTerminated));
+        null_terminated.write(short_values);
+        check_table(null_terminated.read<StringTable>(),
+                    null_terminated.read<std::vector<std::string>>());
+
+        auto null_padded = file.createDataSet("null_padded",
+                                              DataSpace(dims),
+                                              FixedLengthStringType(8, StringPadding::NullPadded));
+        null_padded.write(short_values);
+        check_table(null_padded.read<StringTable>(),
+                    null_padded.read<std::vector<std::string>>());
+    }
+
+    SECTION("not a string") {
+        auto table = StringTable();
+        CHECK(table.empty());
+
+        auto dset = file.createDataSet("numbers", std::vector<int>{1, 2, 3});
+        CHECK_THROWS_AS(dset.read(table), DataTypeException);
+    }
+}
+
 #ifdef HIGHFIVE_TEST_EIGEN
 
 template <typename T>
@@ -2488,6 +3715,100 @@ TEST_CASE("HighFiveEigen") {
 
 #endif
 }
+
+TEST_CASE("HighFiveEigenStrided") {
+    const std::string file_name("test_eigen_strided.h5");
+    File file(file_name, File::Truncate);
+
+    SECTION("column-major") {
+        Eigen::MatrixXd m_in = Eigen::MatrixXd::Random(20, 5);
+        auto dset = file.createDataSet("m", m_in);
+        dset.write(m_in);
+
+        auto m_out = dset.read<Eigen::MatrixXd>();
+        CHECK(m_in == m_out);
+
+        auto rows = dset.select({2, 1}, {10, 3}).read<Eigen::MatrixXd>();
+        CHECK(rows == m_in.block(2, 1, 10, 3));
+
+        Eigen::MatrixXd block = Eigen::MatrixXd::Random(4, 2);
+        dset.select({3, 2}, {4, 2}).write(block);
+        CHECK(dset.select({3, 2}, {4, 2}).read<Eigen::MatrixXd>() == block);
+    }
+
+    SECTION("column-major, staged") {
+        // Large enough to require more than one staging block.
+        Eigen::Index n_rows = 1500;
+        Eigen::Index n_cols = 1000;
+        Eigen::MatrixXd m_in = Eigen::MatrixXd::Random(n_rows, n_cols);
+        auto dset = file.createDataSet("m", m_in);
+        dset.write(m_in);
+
+        auto m_out = dset.read<Eigen::MatrixXd>();
+        CHECK(m_in == m_out);
+
+        auto rows = dset.select({100, 0}, {1400, size_t(n_cols)}).read<Eigen::MatrixXd>();
+        CHECK(rows == m_in.bottomRows(1400));
+
+        Eigen::MatrixXd rows_in = Eigen::MatrixXd::Random(1400, n_cols);
+        dset.select({100, 0}, {1400, size_t(n_cols)}).write(rows_in);
+        m_out = dset.read<Eigen::MatrixXd>();
+        CHECK(m_out.bottomRows(1400) == rows_in);
+
+        auto sliced = dset.select({0, 1}, {size_t(n_rows) / 2, 3}, {2, 2}).read<Eigen::MatrixXd>();
+        for (Eigen::Index i = 0; i < sliced.rows(); ++i) {
+            for (Eigen::Index j = 0; j < sliced.cols(); ++j) {
+                CHECK(sliced(i, j) == m_out(2 * i, 1 + 2 * j));
+            }
+        }
+    }
+
+    SECTION("padded leading dimension") {
+        using RowMajorMatrix = Eigen::Matrix<int, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+        using PaddedMap = Eigen::Map<RowMajorMatrix, 0, Eigen::OuterStride<>>;
+
+        size_t n_rows = 4, n_cols = 3, ld = 5;
+        std::vector<int> storage(n_rows * ld, -1);
+        auto m_in = PaddedMap(storage.data(), 4, 3, Eigen::OuterStride<>(Eigen::Index(ld)));
+        for (Eigen::Index i = 0; i < m_in.rows(); ++i) {
+            for (Eigen::Index j = 0; j < m_in.cols(); ++j) {
+                m_in(i, j) = int(10 * i + j);
+            }
+        }
+
+        auto dset = file.createDataSet("m", m_in);
+        dset.write(m_in);
+        CHECK(dset.read<RowMajorMatrix>() == m_in);
+
+        std::vector<int> out_storage(n_rows * ld, -1);
+        auto m_out = PaddedMap(out_storage.data(), 4, 3, Eigen::OuterStride<>(Eigen::Index(ld)));
+        dset.read(m_out);
+        CHECK(m_out == m_in);
+        for (size_t i = 0; i < n_rows; ++i) {
+            for (size_t j = n_cols; j < ld; ++j) {
+                CHECK(out_storage[i * ld + j] == -1);
+            }
+        }
+    }
+
+    SECTION("inner stride") {
+        using StridedMap = Eigen::Map<Eigen::VectorXd, 0, Eigen::InnerStride<3>>;
+
+        std::vector<double> storage(3 * 7);
+        std::iota(storage.begin(), storage.end(), 0.0);
+        auto v_in = StridedMap(storage.data(), 7);
+
+        auto dset = file.createDataSet("v", v_in);
+        dset.write(v_in);
+
+        std::vector<double> out_storage(3 * 7, -1.0);
+        auto v_out = StridedMap(out_storage.data(), 7);
+        dset.read(v_out);
+        CHECK(v_out == v_in);
+        CHECK(out_storage[1] == -1.0);
+        CHECK(out_storage[3] == 3.0);
+    }
+}
 #endif
 
 TEST_CASE("Logging") {
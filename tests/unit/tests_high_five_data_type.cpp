@@ -320,6 +320,34 @@ TEST_CASE("HighFiveCompoundsSeveralPadding") {
     }
 }
 
+TEST_CASE("HighFiveCompoundsPaddingTransferBuffer") {
+    const std::string file_name("padded_compounds_transfer_buffer.h5");
+    File file(file_name, File::Truncate);
+
+    // Leave non-zero bytes in the staging memory.
+    auto transfer_buffer = TransferBuffer();
+    auto ones = std::vector<std::vector<uint8_t>>(2, std::vector<uint8_t>(sizeof(Record<8>), 0xff));
+    file.createDataSet("ones", ones).write(ones, transfer_buffer);
+
+    // `Record<8>` has 4 bytes of padding at the end.
+    auto record = Record<8>();
+    std::memset(static_cast<void*>(&record), 0, sizeof(record));
+    record.d = 3.14;
+    record.i = 42;
+    fill<8>(record);
+    auto recs = std::vector<std::vector<Record<8>>>(2, std::vector<Record<8>>(1, record));
+
+    auto dataset = file.createDataSet<Record<8>>("records", DataSpace({2, 1}));
+    dataset.write(recs, transfer_buffer);
+
+    auto bytes = std::vector<uint8_t>(2 * sizeof(Record<8>));
+    dataset.read_raw(bytes.data(), dataset.getDataType());
+    for (size_t i = 0; i < 2; ++i) {
+        const auto* padding = bytes.data() + (i + 1) * sizeof(Record<8>) - 4;
+        CHECK(std::all_of(padding, padding + 4, [](uint8_t b) { return b == 0; }));
+    }
+}
+
 enum Position {
     highfive_first = 1,
     highfive_second = 2,
@@ -425,3 +453,35 @@ TEST_CASE("HighFiveReadType") {
     CHECK(t2 == t1);
     CHECK(t4 == t3);
 }
+
+TEST_CASE("HighFiveDataTypeCache") {
+    auto d1 = details::DataTypeCache::get<double>();
+    auto d2 = details::DataTypeCache::getChecked<double>();
+    CHECK(d1 == AtomicType<double>());
+    CHECK(d1.getId() == details::DataTypeCache::get<double>().getId());
+    CHECK(d2.getId() == details::DataTypeCache::getChecked<double>().getId());
+
+    auto c1 = details::DataTypeCache::get<CSL1>();
+    auto c2 = details::DataTypeCache::get<CSL1>();
+    CHECK(c1.getId() == c2.getId());
+    CHECK(c1 == create_compound_csl1());
+
+    // Strings are modified in-place and therefore never cached.
+    auto s1 = details::DataTypeCache::get<std::string>();
+    auto s2 = details::DataTypeCache::get<std::string>();
+    CHECK(s1.getId() != s2.getId());
+    CHECK(s1 == s2);
+
+    // The cached datatypes are shared across files and outlive them.
+    const std::string file_name("datatype_cache.h5");
+    for (int i = 0; i < 2; ++i) {
+        File file(file_name, File::Truncate);
+        std::vector<CSL1> csl = {{1, 2, 3}, {4, 5, 6}};
+        auto dataset = file.createDataSet("csl", csl);
+
+        auto result = dataset.read<std::vector<CSL1>>();
+        CHECK(result[1].m3 == 6);
+    }
+
+    CHECK(details::DataTypeCache::get<CSL1>().getId() == c1.getId());
+}
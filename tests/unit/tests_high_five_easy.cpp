@@ -217,6 +217,40 @@ TEST_CASE("H5Easy_Attribute_scalar") {
     }
 }
 
+TEST_CASE("H5Easy_Series") {
+    H5Easy::File file("h5easy_series.h5", H5Easy::File::Overwrite);
+
+    {
+        H5Easy::Series<double> series(file, "/path/to/t");
+        for (size_t i = 0; i < 10000; ++i) {
+            series.push_back(double(i));
+        }
+        CHECK(series.size() == 10000);
+
+        auto create_props = series.getDataSet().getCreatePropertyList();
+        auto chunking = HighFive::Chunking(create_props);
+        CHECK(chunking.getDimensions() == std::vector<hsize_t>{8192});
+    }
+
+    CHECK(H5Easy::getShape(file, "/path/to/t") == std::vector<size_t>{10000});
+
+    H5Easy::DumpOptions options(H5Easy::Flush::False);
+    options.setChunkSize({16});
+    H5Easy::Series<double> series(file, "/path/to/t", options);
+    series.push_back(10000.0);
+    series.flush();
+
+    auto expected = std::vector<double>(10001);
+    for (size_t i = 0; i < expected.size(); ++i) {
+        expected[i] = double(i);
+    }
+    CHECK(H5Easy::load<std::vector<double>>(file, "/path/to/t") == expected);
+    CHECK(H5Easy::load<double>(file, "/path/to/t", {42}) == 42.0);
+
+    H5Easy::dump(file, "/path/to/x", 1.0);
+    CHECK_THROWS(H5Easy::Series<double>(file, "/path/to/x"));
+}
+
 
 #ifdef HIGHFIVE_TEST_XTENSOR
 TEST_CASE("H5Easy_extend1d") {